@@ -157,8 +157,8 @@ void rgb_u8_to_planar_float_0_1(const uint8_t *rgb, float *out_chw, uint16_t W)
 // Allocate buffers
 // =====================================
 void alloc_buffers() {
-  A   = (float*)malloc(48 * 48 * 16 * sizeof(float)); // 2nd largest
-  B   = (float*)malloc(48 * 48 * 16 * sizeof(float)); //largest
+  A   = (float*)malloc(48 * 48 * 8 * sizeof(float));  // stem output
+  B   = (float*)malloc(48 * 48 * 16 * sizeof(float)); // largest; dw+pw blocks never store the dw map
   RGB = (uint8_t*)malloc(IN_RGB_BYTES); // 27648 bytes
 }
 
@@ -176,115 +176,76 @@ void run_vww_on_IN_and_report() {
   //Serial.println(V);
 
   ConvMem d01; d01.K=3; d01.P=1; d01.S=1; d01.weight=w02; d01.bias=b02; d01.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 8, B, W, d01, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-
   ConvMem c02; c02.K=1; c02.P=0; c02.S=1; c02.weight=w03; c02.bias=b03; c02.act=ACT_RELU;
-  V = noodle_conv_float(B, 8, 16, A, W, c02, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(A, 8, 16, B, W, d01, c02, POOL_ID, nullptr); W = V;
   //Serial.println(V);
 
   ConvMem d03; d03.K=3; d03.P=AUTO; d03.S=2; d03.weight=w04; d03.bias=b04; d03.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 16, B, W, d03, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c04; c04.K=1; c04.P=0; c04.S=1; c04.weight=w05; c04.bias=b05; c04.act=ACT_RELU;
-  V = noodle_conv_float(B, 16, 32, A, W, c04, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(B, 16, 32, A, W, d03, c04, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d05; d05.K=3; d05.P=1; d05.S=1; d05.weight=w06; d05.bias=b06; d05.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 32, B, W, d05, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c06; c06.K=1; c06.P=0; c06.S=1; c06.weight=w07; c06.bias=b07; c06.act=ACT_RELU;
-  V = noodle_conv_float(B, 32, 32, A, W, c06, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(A, 32, 32, B, W, d05, c06, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d07; d07.K=3; d07.P=AUTO; d07.S=2; d07.weight=w08; d07.bias=b08; d07.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 32, B, W, d07, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c08; c08.K=1; c08.P=0; c08.S=1; c08.weight=w09; c08.bias=b09; c08.act=ACT_RELU;
-  V = noodle_conv_float(B, 32, 64, A, W, c08, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(B, 32, 64, A, W, d07, c08, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d09; d09.K=3; d09.P=1; d09.S=1; d09.weight=w10; d09.bias=b10; d09.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 64, B, W, d09, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c10; c10.K=1; c10.P=0; c10.S=1; c10.weight=w11; c10.bias=b11; c10.act=ACT_RELU;
-  V = noodle_conv_float(B, 64, 64, A, W, c10, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(A, 64, 64, B, W, d09, c10, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d11; d11.K=3; d11.P=AUTO; d11.S=2; d11.weight=w12; d11.bias=b12; d11.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 64, B, W, d11, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c12; c12.K=1; c12.P=0; c12.S=1; c12.weight=w13; c12.bias=b13; c12.act=ACT_RELU;
-  V = noodle_conv_float(B, 64, 128, A, W, c12, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(B, 64, 128, A, W, d11, c12, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d13; d13.K=3; d13.P=1; d13.S=1; d13.weight=w14; d13.bias=b14; d13.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 128, B, W, d13, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c14; c14.K=1; c14.P=0; c14.S=1; c14.weight=w15; c14.bias=b15; c14.act=ACT_RELU;
-  V = noodle_conv_float(B, 128, 128, A, W, c14, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(A, 128, 128, B, W, d13, c14, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d15; d15.K=3; d15.P=1; d15.S=1; d15.weight=w16; d15.bias=b16; d15.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 128, B, W, d15, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-
   ConvMem c16; c16.K=1; c16.P=0; c16.S=1; c16.weight=w17; c16.bias=b17; c16.act=ACT_RELU;
-  V = noodle_conv_float(B, 128, 128, A, W, c16, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(B, 128, 128, A, W, d15, c16, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d17; d17.K=3; d17.P=1; d17.S=1; d17.weight=w18; d17.bias=b18; d17.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 128, B, W, d17, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c18; c18.K=1; c18.P=0; c18.S=1; c18.weight=w19; c18.bias=b19; c18.act=ACT_RELU;
-  V = noodle_conv_float(B, 128, 128, A, W, c18, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(A, 128, 128, B, W, d17, c18, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d19; d19.K=3; d19.P=1; d19.S=1; d19.weight=w20; d19.bias=b20; d19.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 128, B, W, d19, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c20; c20.K=1; c20.P=0; c20.S=1; c20.weight=w21; c20.bias=b21; c20.act=ACT_RELU;
-  V = noodle_conv_float(B, 128, 128, A, W, c20, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(B, 128, 128, A, W, d19, c20, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d21; d21.K=3; d21.P=1; d21.S=1; d21.weight=w22; d21.bias=b22; d21.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 128, B, W, d21, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c22; c22.K=1; c22.P=0; c22.S=1; c22.weight=w23; c22.bias=b23; c22.act=ACT_RELU;
-  V = noodle_conv_float(B, 128, 128, A, W, c22, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(A, 128, 128, B, W, d21, c22, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d23; d23.K=3; d23.P=AUTO; d23.S=2; d23.weight=w24; d23.bias=b24; d23.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 128, B, W, d23, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c24; c24.K=1; c24.P=0; c24.S=1; c24.weight=w25; c24.bias=b25; c24.act=ACT_RELU;
-  V = noodle_conv_float(B, 128, 256, A, W, c24, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(B, 128, 256, A, W, d23, c24, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
   ConvMem d25; d25.K=3; d25.P=1; d25.S=1; d25.weight=w26; d25.bias=b26; d25.act=ACT_RELU;
-  V = noodle_dwconv_float(A, 256, B, W, d25, POOL_ID, nullptr); W = V;
-  //Serial.println(V);
-  
   ConvMem c26; c26.K=1; c26.P=0; c26.S=1; c26.weight=w27; c26.bias=b27; c26.act=ACT_RELU;
-  V = noodle_conv_float(B, 256, 256, A, W, c26, POOL_ID, nullptr); W = V;
+  V = noodle_dwpw_float(A, 256, 256, B, W, d25, c26, POOL_ID, nullptr); W = V;
   //Serial.println(V);
   
-  uint16_t C = noodle_gap(A, 256, W);
+  uint16_t C = noodle_gap(B, 256, W);
   //Serial.println(C);
   
   float out2[2];
   FCNMem fcf; fcf.weight = w28; fcf.bias = b28; fcf.act = ACT_SOFTMAX;
-  (void)noodle_fcn((const float*)A, 256, 2, out2, fcf, nullptr);
+  (void)noodle_fcn((const float*)B, 256, 2, out2, fcf, nullptr);
 
   uint8_t pred = (out2[1] > out2[0]) ? 1 : 0;
   Serial.printf("ms=%lu P0=%.6f P1=%.6f pred=%u\n", (unsigned long)0, out2[0], out2[1], pred);
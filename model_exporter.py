@@ -1,4 +1,5 @@
 import os
+import struct
 import numpy as np
 import tensorflow as tf
 
@@ -31,12 +32,65 @@ def _same_len_1d(ws) -> bool:
     L = int(ws[0].shape[0])
     return all(int(x.shape[0]) == L for x in ws)
 
-def _write_array_txt_and_h(out_dir, prefix, idx, arr_1d, header_lines=None):
-    """Write both .txt and .h for a 1D float array."""
+# .ndl container codes; keep in sync with NoodleDType/NoodleLayout in noodle.h.
+NDL_DTYPE_F32 = 0
+NDL_LAYOUTS = {"FLAT": 0, "OIHW": 1, "CKK": 2, "OIK": 3, "OI": 4, "BN": 5}
+NDL_NAME_LEN = 24
+
+class NdlWriter:
+    """Collect float32 tensors and write them as one Noodle .ndl container.
+
+    Layout (little-endian):
+      header  16 B : b"NDL1", u16 version=1, u16 count, u32 align, u32 0
+      entries 48 B : name[24], u8 dtype, u8 layout, u8 rank, u8 0,
+                     u16 dims[4], u32 offset, u32 count, u32 0
+      payloads     : raw float32, each starting at a multiple of align
+    """
+
+    def __init__(self, align: int = 512):
+        self.align = int(align)
+        self.tensors = []
+
+    def add(self, name: str, arr, layout: str = "FLAT", dims=None):
+        arr = np.asarray(arr, dtype="<f4").reshape(-1)
+        if len(name.encode()) > NDL_NAME_LEN:
+            raise ValueError(f"{name}: tensor name longer than {NDL_NAME_LEN} bytes")
+        dims = tuple(int(d) for d in (dims if dims is not None else (arr.shape[0],)))
+        if len(dims) > 4 or any(d > 0xFFFF for d in dims):
+            raise ValueError(f"{name}: dims {dims} do not fit the .ndl table")
+        self.tensors.append((name, arr, NDL_LAYOUTS[layout], dims))
+
+    def _aligned(self, n: int) -> int:
+        return (n + self.align - 1) // self.align * self.align
+
+    def write(self, path: str):
+        table_end = 16 + 48 * len(self.tensors)
+        offset = self._aligned(table_end)
+        entries = []
+        for name, arr, layout, dims in self.tensors:
+            d4 = list(dims) + [0] * (4 - len(dims))
+            entries.append(struct.pack("<24sBBBB4HIII", name.encode(), NDL_DTYPE_F32,
+                                       layout, len(dims), 0, *d4, offset, arr.shape[0], 0))
+            offset = self._aligned(offset + arr.nbytes)
+
+        with open(path, "wb") as f:
+            f.write(struct.pack("<4sHHII", b"NDL1", 1, len(self.tensors), self.align, 0))
+            for e in entries:
+                f.write(e)
+            for _, arr, _, _ in self.tensors:
+                f.write(b"\0" * (self._aligned(f.tell()) - f.tell()))
+                f.write(arr.tobytes())
+        print(path)
+
+def _write_array_txt_and_h(out_dir, prefix, idx, arr_1d, header_lines=None,
+                           ndl=None, layout="FLAT", dims=None):
+    """Write both .txt and .h for a 1D float array, and add it to ndl if given."""
     if header_lines is None:
         header_lines = []
 
     arr_1d = np.asarray(arr_1d, dtype=np.float32).reshape(-1)
+    if ndl is not None:
+        ndl.add(f"{prefix}{to_two_digit_string(idx)}", arr_1d, layout, dims)
 
     fn_txt = os.path.join(out_dir, f"{prefix}{to_two_digit_string(idx)}.txt")
     print(fn_txt)
@@ -53,7 +107,64 @@ def _write_array_txt_and_h(out_dir, prefix, idx, arr_1d, header_lines=None):
         f.write(format_c_array(arr_1d))
         f.write("\n};\n")
 
-def _consume_bias_and_bn(weights, k_after_kernel, out_dir, b_idx, bn_idx):
+def _winograd_f2x3(Wn: np.ndarray) -> np.ndarray:
+    """Transform (Cout,Cin,3,3) kernels to U = G g G^T packed as [16][Cout][Cin].
+
+    Matches noodle_winograd_weights(); point ConvMem::winograd at the result.
+    """
+    G = np.array([[1.0, 0.0, 0.0],
+                  [0.5, 0.5, 0.5],
+                  [0.5, -0.5, 0.5],
+                  [0.0, 0.0, 1.0]], dtype=np.float32)
+    U = np.einsum("ak,oikl,bl->aboi", G, Wn.astype(np.float32), G)
+    O, I = Wn.shape[:2]
+    return U.reshape(16, O, I).astype(np.float32)
+
+def _write_winograd(out_dir, w_idx, Wn, ndl=None):
+    """Write uXX next to wXX for a 3x3 stride-1 Conv2D."""
+    O, I = Wn.shape[:2]
+    U = _winograd_f2x3(Wn)
+    _write_array_txt_and_h(
+        out_dir, "u", w_idx, U.flatten(order="C"),
+        header_lines=[
+            "// kind=winograd_f2x3, layout=[16][Cout][Cin]",
+            f"// dims: Cin={I}, Cout={O}",
+            f"// pass as ConvMem::winograd together with w{to_two_digit_string(w_idx)}",
+        ],
+        ndl=ndl, layout="FLAT", dims=U.shape,
+    )
+
+def _fold_bn(Wn: np.ndarray, b, gamma, beta, mean, var, eps: float):
+    """Fold inference BatchNormalization into a kernel and bias.
+
+    Wn has the output channel on axis 0; b may be None. Returns (W', b') with
+    W' = W * s and b' = (b - mean) * s + beta, where s = gamma / sqrt(var + eps).
+    """
+    gamma, beta, mean, var = (np.float32(v).reshape(-1) for v in (gamma, beta, mean, var))
+    s = gamma / np.sqrt(var + np.float32(eps))
+    b = np.zeros_like(s) if b is None else np.float32(b).reshape(-1)
+    Wf = np.float32(Wn) * s.reshape((-1,) + (1,) * (Wn.ndim - 1))
+    return Wf.astype(np.float32), ((b - mean) * s + beta).astype(np.float32)
+
+def _fold_bias_and_bn(weights, k_after_kernel, Wn, eps):
+    """
+    Raw-weights counterpart of _consume_bias_and_bn() for fold_bn=True.
+
+    If bias + BN or BN only follows the kernel, with one value per row of Wn,
+    returns (W', b', new_k) with the BN folded in. Otherwise returns
+    (Wn, None, k_after_kernel) and the caller falls back to the normal path.
+    """
+    i = k_after_kernel
+    C = int(Wn.shape[0])
+    if i + 4 < len(weights) and _same_len_1d(weights[i:i+5]) and weights[i].size == C:
+        Wf, bf = _fold_bn(Wn, weights[i], *weights[i+1:i+5], eps)
+        return Wf, bf, i + 5
+    if i + 3 < len(weights) and _same_len_1d(weights[i:i+4]) and weights[i].size == C:
+        Wf, bf = _fold_bn(Wn, None, *weights[i:i+4], eps)
+        return Wf, bf, i + 4
+    return Wn, None, i
+
+def _consume_bias_and_bn(weights, k_after_kernel, out_dir, b_idx, bn_idx, ndl=None):
     """
     After a kernel tensor, consume (in order) one of:
       (A) bias + BN : 5 consecutive 1D vectors same length
@@ -69,7 +180,7 @@ def _consume_bias_and_bn(weights, k_after_kernel, out_dir, b_idx, bn_idx):
         # bias
         b = np.float32(weights[i].flatten())
         b_idx += 1
-        _write_array_txt_and_h(out_dir, "b", b_idx, b)
+        _write_array_txt_and_h(out_dir, "b", b_idx, b, ndl=ndl)
 
         # BN packed: gamma, beta, mean, var
         gamma = np.float32(weights[i+1].flatten())
@@ -86,6 +197,7 @@ def _consume_bias_and_bn(weights, k_after_kernel, out_dir, b_idx, bn_idx):
                 "// order: gamma(C), beta(C), mean(C), var(C)",
                 f"// C={int(gamma.shape[0])}",
             ],
+            ndl=ndl, layout="BN", dims=(4, int(gamma.shape[0])),
         )
 
         return i + 5, b_idx, bn_idx
@@ -106,6 +218,7 @@ def _consume_bias_and_bn(weights, k_after_kernel, out_dir, b_idx, bn_idx):
                 "// order: gamma(C), beta(C), mean(C), var(C)",
                 f"// C={int(gamma.shape[0])}",
             ],
+            ndl=ndl, layout="BN", dims=(4, int(gamma.shape[0])),
         )
 
         return i + 4, b_idx, bn_idx
@@ -114,12 +227,13 @@ def _consume_bias_and_bn(weights, k_after_kernel, out_dir, b_idx, bn_idx):
     if i < len(weights) and _is_1d(weights[i]):
         b = np.float32(weights[i].flatten())
         b_idx += 1
-        _write_array_txt_and_h(out_dir, "b", b_idx, b)
+        _write_array_txt_and_h(out_dir, "b", b_idx, b, ndl=ndl)
         return i + 1, b_idx, bn_idx
 
     return i, b_idx, bn_idx
 
-def exporter(weights, out_dir: str):
+def exporter(weights, out_dir: str, ndl_path: str | None = None,
+             fold_bn: bool = False, bn_eps: float = 1e-3):
     """
     Export Keras weights (from model.get_weights()) into Noodle-friendly files.
 
@@ -139,11 +253,20 @@ def exporter(weights, out_dir: str):
         (B) BN only   (4x 1D same length)
         (C) bias only (1x 1D)
       This prevents bias being mis-detected as BN elsewhere.
+
+    If ndl_path is given, the same tensors are also packed into one .ndl
+    container (see NdlWriter).
+
+    With fold_bn=True, a BN group (A or B) is folded into the preceding kernel
+    and written as its bias instead of bnXX, so the firmware can drop the
+    noodle_bn*() call. Only valid when the layer has no activation before the
+    BN. bn_eps must match the BatchNormalization epsilon (Keras default 1e-3).
     """
     if not out_dir.endswith("/"):
         out_dir += "/"
     os.makedirs(out_dir, exist_ok=True)
 
+    ndl = NdlWriter() if ndl_path else None
     w_idx = 0
     b_idx = 0
     bn_idx = 0
@@ -171,6 +294,7 @@ def exporter(weights, out_dir: str):
                 # (Kh, Kw, Cin, Cout) -> (Cout, Cin, Kh, Kw)
                 w_oihw = np.transpose(w, (3, 2, 0, 1)).astype(np.float32)
                 flat = w_oihw.flatten(order="C")
+                ndl_layout, ndl_dims = "OIHW", w_oihw.shape
                 header = [
                     f"// kind={kind}, layout={layout}",
                     f"// dims: Kh={Kh}, Kw={Kw}, Cin={Cin}, Cout={C4}",
@@ -185,16 +309,30 @@ def exporter(weights, out_dir: str):
                 dw = w[:, :, :, 0]  # (Kh, Kw, Cin)
                 w_ckk = np.transpose(dw, (2, 0, 1)).astype(np.float32)  # (Cin, Kh, Kw)
                 flat = w_ckk.flatten(order="C")
+                ndl_layout, ndl_dims = "CKK", w_ckk.shape
 
                 header = [
                     f"// kind=depthwise2d, layout=CKK",
                     f"// dims: Kh={Kh}, Kw={Kw}, Cin={Cin}, M=1, Cout={Cin}",
                 ]
 
-            _write_array_txt_and_h(out_dir, "w", w_idx, flat, header_lines=header)
+            folded = None
+            if fold_bn:
+                n_out = int(C4) if kind == "conv2d" else int(Cin)
+                Wf, folded, k_next = _fold_bias_and_bn(weights, k + 1, flat.reshape(n_out, -1), bn_eps)
+                flat = Wf.flatten(order="C")
+
+            _write_array_txt_and_h(out_dir, "w", w_idx, flat, header_lines=header,
+                                   ndl=ndl, layout=ndl_layout, dims=ndl_dims)
+
+            if folded is not None:
+                b_idx += 1
+                _write_array_txt_and_h(out_dir, "b", b_idx, folded, header_lines=["// batchnorm folded"], ndl=ndl)
+                k = k_next
+                continue
 
             # Consume optional bias+BN immediately after this kernel
-            k, b_idx, bn_idx = _consume_bias_and_bn(weights, k + 1, out_dir, b_idx, bn_idx)
+            k, b_idx, bn_idx = _consume_bias_and_bn(weights, k + 1, out_dir, b_idx, bn_idx, ndl)
             continue
 
         # ---------- 3D: Conv1D / DWConv1D ----------
@@ -222,6 +360,7 @@ def exporter(weights, out_dir: str):
                 # (K, Cin, Cout) -> (Cout, Cin, K)
                 w_oik = np.transpose(w, (2, 1, 0)).astype(np.float32)
                 flat = w_oik.flatten(order="C")
+                ndl_layout, ndl_dims = "OIK", w_oik.shape
                 header = [
                     f"// kind={kind}, layout={layout}",
                     f"// dims: K={K1}, Cin={Cin}, Cout={C3}",
@@ -231,15 +370,29 @@ def exporter(weights, out_dir: str):
                 M = int(C3)
                 w_cmk = np.transpose(w, (1, 2, 0)).astype(np.float32)
                 flat = w_cmk.flatten(order="C")
+                ndl_layout, ndl_dims = "FLAT", w_cmk.shape
                 header = [
                     f"// kind={kind}, layout={layout}",
                     f"// dims: K={K1}, Cin={Cin}, M={M}, Cout={Cin*M}",
                 ]
 
-            _write_array_txt_and_h(out_dir, "w", w_idx, flat, header_lines=header)
+            folded = None
+            if fold_bn:
+                n_out = int(C3) if kind == "conv1d" else int(Cin * C3)
+                Wf, folded, k_next = _fold_bias_and_bn(weights, k + 1, flat.reshape(n_out, -1), bn_eps)
+                flat = Wf.flatten(order="C")
+
+            _write_array_txt_and_h(out_dir, "w", w_idx, flat, header_lines=header,
+                                   ndl=ndl, layout=ndl_layout, dims=ndl_dims)
+
+            if folded is not None:
+                b_idx += 1
+                _write_array_txt_and_h(out_dir, "b", b_idx, folded, header_lines=["// batchnorm folded"], ndl=ndl)
+                k = k_next
+                continue
 
             # Consume optional bias+BN immediately after this kernel
-            k, b_idx, bn_idx = _consume_bias_and_bn(weights, k + 1, out_dir, b_idx, bn_idx)
+            k, b_idx, bn_idx = _consume_bias_and_bn(weights, k + 1, out_dir, b_idx, bn_idx, ndl)
             continue
 
         # ---------- 2D: Dense ----------
@@ -247,23 +400,38 @@ def exporter(weights, out_dir: str):
             w_idx += 1
             # Dense kernel: (Din, Dout) -> store as (Dout, Din)
             flat = np.float32(w.transpose().flatten())
-            _write_array_txt_and_h(out_dir, "w", w_idx, flat, header_lines=["// kind=dense (stored OI)"])
+            folded = None
+            if fold_bn:
+                Wf, folded, k_next = _fold_bias_and_bn(weights, k + 1, flat.reshape(w.shape[1], -1), bn_eps)
+                flat = Wf.flatten(order="C")
+            _write_array_txt_and_h(out_dir, "w", w_idx, flat, header_lines=["// kind=dense (stored OI)"],
+                                   ndl=ndl, layout="OI", dims=(w.shape[1], w.shape[0]))
+
+            if folded is not None:
+                b_idx += 1
+                _write_array_txt_and_h(out_dir, "b", b_idx, folded, header_lines=["// batchnorm folded"], ndl=ndl)
+                k = k_next
+                continue
 
             # Consume optional bias immediately after this kernel
-            k, b_idx, bn_idx = _consume_bias_and_bn(weights, k + 1, out_dir, b_idx, bn_idx)
+            k, b_idx, bn_idx = _consume_bias_and_bn(weights, k + 1, out_dir, b_idx, bn_idx, ndl)
             continue
 
         # ---------- 1D standalone (rare): treat as bias ----------
         if _is_1d(w):
             b_idx += 1
             arr = np.float32(w.flatten())
-            _write_array_txt_and_h(out_dir, "b", b_idx, arr, header_lines=["// standalone 1D (treated as bias)"])
+            _write_array_txt_and_h(out_dir, "b", b_idx, arr, header_lines=["// standalone 1D (treated as bias)"],
+                                   ndl=ndl)
             k += 1
             continue
 
         print("Skipping unsupported tensor with shape:", getattr(w, "shape", None))
         k += 1
 
+    if ndl is not None:
+        ndl.write(ndl_path)
+
 ###############################################################################
 
 # -------------------------------------------------------------------------------------------------
@@ -453,14 +621,14 @@ def debug_tflite_ops(tflite_path):
 # We already validated the Conv2DTranspose export with NO spatial kernel flip.
 # =============================================================================
 
-def _write_bias_if_present(out_dir: str, b_idx: int, weights: list) -> int:
+def _write_bias_if_present(out_dir: str, b_idx: int, weights: list, ndl=None) -> int:
     """Write bias if the second item in layer.get_weights() is a 1D vector."""
     if len(weights) >= 2 and _is_1d(weights[1]):
         b_idx += 1
-        _write_array_txt_and_h(out_dir, "b", b_idx, np.float32(weights[1].reshape(-1)))
+        _write_array_txt_and_h(out_dir, "b", b_idx, np.float32(weights[1].reshape(-1)), ndl=ndl)
     return b_idx
 
-def _write_bn_from_layer(out_dir: str, bn_idx: int, weights: list) -> int:
+def _write_bn_from_layer(out_dir: str, bn_idx: int, weights: list, ndl=None) -> int:
     """Write BatchNormalization weights as packed gamma,beta,mean,var."""
     if len(weights) != 4 or not _same_len_1d(weights):
         raise ValueError("BatchNormalization layer must have gamma,beta,mean,var as four same-length 1D arrays.")
@@ -479,10 +647,47 @@ def _write_bn_from_layer(out_dir: str, bn_idx: int, weights: list) -> int:
             "// order: gamma(C), beta(C), mean(C), var(C)",
             f"// C={int(gamma.shape[0])}",
         ],
+        ndl=ndl, layout="BN", dims=(4, int(gamma.shape[0])),
     )
     return bn_idx
 
-def exporter_model(model, out_dir: str):
+def _foldable_bn(layers, li):
+    """Return the BatchNormalization layer right after layers[li] if it can be folded.
+
+    The weighted layer must be linear and feed the BN directly, and the BN
+    must carry all four gamma,beta,mean,var vectors.
+    """
+    if li + 1 >= len(layers):
+        return None
+    layer, bn = layers[li], layers[li + 1]
+    if bn.__class__.__name__ != "BatchNormalization" or len(bn.get_weights()) != 4:
+        return None
+    act = getattr(layer, "activation", None)
+    if act is not None and getattr(act, "__name__", "") != "linear":
+        return None
+    try:
+        if bn.input is not layer.output:
+            return None
+    except (AttributeError, ValueError):
+        pass
+    return bn
+
+def _fold_layer_bn(layers, li, Wn, ws, skip):
+    """Fold the BN following layers[li] into Wn and its bias when possible.
+
+    Returns (Wn, ws) where ws has the folded bias as its second entry, and
+    adds the BN layer to skip so the export loop does not write bnXX for it.
+    """
+    bn = _foldable_bn(layers, li)
+    if bn is None:
+        return Wn, ws
+    b = ws[1] if len(ws) >= 2 and _is_1d(ws[1]) else None
+    Wf, bf = _fold_bn(Wn, b, *bn.get_weights(), getattr(bn, "epsilon", 1e-3))
+    skip.add(id(bn))
+    return Wf, [ws[0], bf]
+
+def exporter_model(model, out_dir: str, ndl_path: str | None = None,
+                   winograd: bool = False, fold_bn: bool = False):
     """
     Export a Keras model layer-by-layer into Noodle-friendly files.
 
@@ -517,20 +722,33 @@ def exporter_model(model, out_dir: str):
 
     Bias vectors are written as bXX immediately after the corresponding
     weighted layer in layer traversal order.
+
+    If ndl_path is given, the same tensors are also packed into one .ndl
+    container (see NdlWriter).
+
+    With winograd=True, every 3x3 stride-1 Conv2D also gets uXX holding its
+    Winograd F(2x2,3x3) weights for ConvMem::winograd.
+
+    With fold_bn=True, a BatchNormalization that directly follows a linear
+    weighted layer is folded into that layer's kernel and bias (written as
+    bXX, created if the layer had none) and gets no bnXX file.
     """
     if not out_dir.endswith("/"):
         out_dir += "/"
     os.makedirs(out_dir, exist_ok=True)
 
+    ndl = NdlWriter() if ndl_path else None
     w_idx = 0
     b_idx = 0
     bn_idx = 0
+    layers = list(model.layers)
+    skip = set()
 
-    for layer in model.layers:
+    for li, layer in enumerate(layers):
         cls = layer.__class__.__name__
         ws = layer.get_weights()
 
-        if len(ws) == 0:
+        if len(ws) == 0 or id(layer) in skip:
             continue
 
         # ---------- Conv2D ----------
@@ -542,6 +760,8 @@ def exporter_model(model, out_dir: str):
 
             w_idx += 1
             Wn = np.transpose(W, (3, 2, 0, 1)).astype(np.float32)  # Cout,Cin,Kh,Kw
+            if fold_bn:
+                Wn, ws = _fold_layer_bn(layers, li, Wn, ws, skip)
             _write_array_txt_and_h(
                 out_dir, "w", w_idx, Wn.flatten(order="C"),
                 header_lines=[
@@ -550,8 +770,11 @@ def exporter_model(model, out_dir: str):
                     f"// dims: Kh={Kh}, Kw={Kw}, Cin={Cin}, Cout={Cout}",
                     "// Keras: (Kh,Kw,Cin,Cout) -> Noodle: (Cout,Cin,Kh,Kw)",
                 ],
+                ndl=ndl, layout="OIHW", dims=Wn.shape,
             )
-            b_idx = _write_bias_if_present(out_dir, b_idx, ws)
+            if winograd and (Kh, Kw) == (3, 3) and tuple(layer.strides) == (1, 1):
+                _write_winograd(out_dir, w_idx, Wn, ndl)
+            b_idx = _write_bias_if_present(out_dir, b_idx, ws, ndl)
             continue
 
         # ---------- Conv2DTranspose ----------
@@ -563,6 +786,8 @@ def exporter_model(model, out_dir: str):
 
             w_idx += 1
             Wn = np.transpose(W, (2, 3, 0, 1)).astype(np.float32)  # Cout,Cin,Kh,Kw
+            if fold_bn:
+                Wn, ws = _fold_layer_bn(layers, li, Wn, ws, skip)
             _write_array_txt_and_h(
                 out_dir, "w", w_idx, Wn.flatten(order="C"),
                 header_lines=[
@@ -572,8 +797,9 @@ def exporter_model(model, out_dir: str):
                     "// Keras: (Kh,Kw,Cout,Cin) -> Noodle: (Cout,Cin,Kh,Kw)",
                     "// spatial_flip=false",
                 ],
+                ndl=ndl, layout="OIHW", dims=Wn.shape,
             )
-            b_idx = _write_bias_if_present(out_dir, b_idx, ws)
+            b_idx = _write_bias_if_present(out_dir, b_idx, ws, ndl)
             continue
 
         # ---------- DepthwiseConv2D ----------
@@ -587,6 +813,8 @@ def exporter_model(model, out_dir: str):
 
             w_idx += 1
             Wn = np.transpose(W[:, :, :, 0], (2, 0, 1)).astype(np.float32)  # Cin,Kh,Kw
+            if fold_bn:
+                Wn, ws = _fold_layer_bn(layers, li, Wn, ws, skip)
             _write_array_txt_and_h(
                 out_dir, "w", w_idx, Wn.flatten(order="C"),
                 header_lines=[
@@ -594,8 +822,9 @@ def exporter_model(model, out_dir: str):
                     f"// layer={layer.name}",
                     f"// dims: Kh={Kh}, Kw={Kw}, Cin={Cin}, M=1, Cout={Cin}",
                 ],
+                ndl=ndl, layout="CKK", dims=Wn.shape,
             )
-            b_idx = _write_bias_if_present(out_dir, b_idx, ws)
+            b_idx = _write_bias_if_present(out_dir, b_idx, ws, ndl)
             continue
 
         # ---------- Conv1D ----------
@@ -607,6 +836,8 @@ def exporter_model(model, out_dir: str):
 
             w_idx += 1
             Wn = np.transpose(W, (2, 1, 0)).astype(np.float32)  # Cout,Cin,K
+            if fold_bn:
+                Wn, ws = _fold_layer_bn(layers, li, Wn, ws, skip)
             _write_array_txt_and_h(
                 out_dir, "w", w_idx, Wn.flatten(order="C"),
                 header_lines=[
@@ -614,8 +845,9 @@ def exporter_model(model, out_dir: str):
                     f"// layer={layer.name}",
                     f"// dims: K={K1}, Cin={Cin}, Cout={Cout}",
                 ],
+                ndl=ndl, layout="OIK", dims=Wn.shape,
             )
-            b_idx = _write_bias_if_present(out_dir, b_idx, ws)
+            b_idx = _write_bias_if_present(out_dir, b_idx, ws, ndl)
             continue
 
         # ---------- Dense ----------
@@ -627,6 +859,8 @@ def exporter_model(model, out_dir: str):
 
             w_idx += 1
             Wn = W.transpose().astype(np.float32)  # Dout,Din
+            if fold_bn:
+                Wn, ws = _fold_layer_bn(layers, li, Wn, ws, skip)
             _write_array_txt_and_h(
                 out_dir, "w", w_idx, Wn.flatten(order="C"),
                 header_lines=[
@@ -634,17 +868,21 @@ def exporter_model(model, out_dir: str):
                     f"// layer={layer.name}",
                     f"// dims: Din={Din}, Dout={Dout}",
                 ],
+                ndl=ndl, layout="OI", dims=Wn.shape,
             )
-            b_idx = _write_bias_if_present(out_dir, b_idx, ws)
+            b_idx = _write_bias_if_present(out_dir, b_idx, ws, ndl)
             continue
 
         # ---------- BatchNormalization ----------
         if cls == "BatchNormalization":
-            bn_idx = _write_bn_from_layer(out_dir, bn_idx, ws)
+            bn_idx = _write_bn_from_layer(out_dir, bn_idx, ws, ndl)
             continue
 
         print(f"Skipping unsupported weighted layer {layer.name} ({cls}) with shapes {[w.shape for w in ws]}")
 
+    if ndl is not None:
+        ndl.write(ndl_path)
+
     print(f"Export complete: w={w_idx}, b={b_idx}, bn={bn_idx}, out_dir={out_dir}")
 
 # =============================================================================
@@ -858,17 +1096,27 @@ def _tflite_dense_to_noodle_oi(w_raw: np.ndarray, dout_hint=None) -> np.ndarray:
 
     return w_raw.astype(np.float32)
 
-def exporter_tflite(tflite_path: str, out_dir: str):
+def exporter_tflite(tflite_path: str, out_dir: str, ndl_path: str | None = None,
+                    winograd: bool = False):
     """Export a float .tflite model into Noodle-friendly files.
 
     Supports CONV_2D, DEPTHWISE_CONV_2D, FULLY_CONNECTED, and TRANSPOSE_CONV.
     The function walks TFLite ops in execution order and writes wXX/bXX files
     directly, so Conv2DTranspose tensors are not confused with Conv2D tensors.
+
+    If ndl_path is given, the same tensors are also packed into one .ndl
+    container (see NdlWriter).
+
+    With winograd=True, 3x3 CONV_2D ops whose output keeps the input size
+    (SAME) or loses two pixels (VALID), i.e. stride 1, also get uXX Winograd
+    weights for ConvMem::winograd.
     """
     if not out_dir.endswith("/"):
         out_dir += "/"
     os.makedirs(out_dir, exist_ok=True)
 
+    ndl = NdlWriter() if ndl_path else None
+
     interpreter = tf.lite.Interpreter(model_path=tflite_path)
     interpreter.allocate_tensors()
 
@@ -907,12 +1155,16 @@ def exporter_tflite(tflite_path: str, out_dir: str):
                     f"// dims: Kh={Kh}, Kw={Kw}, Cin={I}, Cout={O}",
                     "// TFLite common: (Cout,Kh,Kw,Cin) -> Noodle: (Cout,Cin,Kh,Kw)",
                 ],
+                ndl=ndl, layout="OIHW", dims=Wn.shape,
             )
+            if (winograd and (Kh, Kw) == (3, 3) and in_shape is not None and out_shape is not None
+                    and out_shape[1] > 1 and out_shape[1] in (in_shape[1], in_shape[1] - 2)):
+                _write_winograd(out_dir, w_idx, Wn, ndl)
 
             b = _find_bias_input(interpreter, ins, expected_len=O, exclude_positions={0, 1})
             if b is not None:
                 b_idx += 1
-                _write_array_txt_and_h(out_dir, "b", b_idx, b)
+                _write_array_txt_and_h(out_dir, "b", b_idx, b, ndl=ndl)
             continue
 
         if op_name == "DEPTHWISE_CONV_2D":
@@ -936,12 +1188,13 @@ def exporter_tflite(tflite_path: str, out_dir: str):
                     f"// tflite_op_index={op_i}",
                     f"// dims: Kh={Kh}, Kw={Kw}, Cin={C}, M=1, Cout={C}",
                 ],
+                ndl=ndl, layout="CKK", dims=Wn.shape,
             )
 
             b = _find_bias_input(interpreter, ins, expected_len=C, exclude_positions={0, 1})
             if b is not None:
                 b_idx += 1
-                _write_array_txt_and_h(out_dir, "b", b_idx, b)
+                _write_array_txt_and_h(out_dir, "b", b_idx, b, ndl=ndl)
             continue
 
         if op_name == "FULLY_CONNECTED":
@@ -966,11 +1219,12 @@ def exporter_tflite(tflite_path: str, out_dir: str):
                     f"// tflite_op_index={op_i}",
                     f"// dims: Din={I}, Dout={O}",
                 ],
+                ndl=ndl, layout="OI", dims=Wn.shape,
             )
 
             if b is not None:
                 b_idx += 1
-                _write_array_txt_and_h(out_dir, "b", b_idx, b)
+                _write_array_txt_and_h(out_dir, "b", b_idx, b, ndl=ndl)
             continue
 
         if op_name == "TRANSPOSE_CONV":
@@ -1015,15 +1269,18 @@ def exporter_tflite(tflite_path: str, out_dir: str):
                     "// TFLite common: (Cout,Kh,Kw,Cin) -> Noodle: (Cout,Cin,Kh,Kw)",
                     "// spatial_flip=false",
                 ],
+                ndl=ndl, layout="OIHW", dims=Wn.shape,
             )
 
             b = _find_bias_input(interpreter, ins, expected_len=O, exclude_positions={w_pos})
             if b is not None:
                 b_idx += 1
-                _write_array_txt_and_h(out_dir, "b", b_idx, b)
+                _write_array_txt_and_h(out_dir, "b", b_idx, b, ndl=ndl)
             continue
 
     write_model_weights_header(out_dir, w_idx, b_idx)
+    if ndl is not None:
+        ndl.write(ndl_path)
     print(f"Export complete: w={w_idx}, b={b_idx}, out_dir={out_dir}")
 
 def debug_tflite_ops(tflite_path):
@@ -1105,6 +1362,17 @@ if __name__ == "__main__":
     )
     
     # Optional flags
+    parser.add_argument(
+        "--ndl",
+        type=str,
+        default=None,
+        help="Also pack all tensors into this single .ndl container file"
+    )
+    parser.add_argument(
+        "--winograd",
+        action="store_true",
+        help="Also write uXX Winograd F(2x2,3x3) weights for 3x3 stride-1 convolutions"
+    )
     parser.add_argument(
         "--debug", 
         action="store_true", 
@@ -1121,5 +1389,6 @@ if __name__ == "__main__":
 
     # Execute the exporter
     print(f"Exporting {args.tflite_path} to directory '{args.out_dir}'...")
-    exporter_tflite(args.tflite_path, args.out_dir)
+    exporter_tflite(args.tflite_path, args.out_dir, ndl_path=args.ndl,
+                    winograd=args.winograd)
     
\ No newline at end of file
@@ -98,6 +98,38 @@ enum Activation : uint8_t {
   ACT_SOFTMAX = 2   ///< Normalize a final output vector where supported.
 };
 
+/**
+ * @brief Algorithm hint for RAM-to-RAM convolution.
+ * @ingroup noodle_public
+ *
+ * Conv1D honours AUTO, DIRECT and IM2COL; WINOGRAD falls back to the direct
+ * kernel there.
+ */
+enum NoodleConvAlgo : uint8_t {
+  CONV_ALGO_AUTO   = 0,  ///< Let Noodle choose; 1x1 stride-1 layers use GEMM.
+  CONV_ALGO_DIRECT = 1,  ///< Always use the direct (output-channel blocked) kernel.
+  CONV_ALGO_IM2COL = 2,  ///< Lower row (or sample) bands with im2col and multiply with SGEMM.
+  CONV_ALGO_WINOGRAD = 3 ///< Winograd F(2x2,3x3) for 3x3 stride-1 layers.
+};
+
+/**
+ * @brief Instruction set of the vectorized kernels, see noodle_simd_active().
+ * @ingroup noodle_public
+ *
+ * On x86 the element-wise kernels (bias/activation, batch normalization, 2x2
+ * pooling) and the SSE2 convolution rows match the scalar loops bit for bit.
+ * Dot products sum in a different order, and the AVX2 and NEON convolution
+ * kernels use fused multiply-add, so those results differ only by rounding.
+ * The documented tolerance is `1e-5` times the sum of the absolute products;
+ * host tests measure below `5e-7`.
+ */
+enum NoodleSimd : uint8_t {
+  SIMD_SCALAR = 0,  ///< Portable scalar reference loops.
+  SIMD_SSE2   = 1,  ///< x86 SSE2.
+  SIMD_AVX2   = 2,  ///< x86 AVX2 with FMA.
+  SIMD_NEON   = 3   ///< AArch64 NEON.
+};
+
 /**
  * @brief File-backed convolution parameter bundle.
  * @ingroup noodle_public
@@ -169,6 +201,8 @@ struct ConvMem {
 
   Activation act = ACT_RELU;        ///< Activation applied after adding bias.
   uint16_t O = 0;                   ///< Optional output channel count for tensor wrappers.
+  NoodleConvAlgo algo = CONV_ALGO_AUTO;  ///< Algorithm hint for RAM-to-RAM convolution.
+  const float *winograd = nullptr;  ///< Optional `[16][O][I]` Winograd weights, see noodle_winograd_weights().
 };
 
 /**
@@ -263,6 +297,111 @@ struct FCNProgmem {
   uint16_t O          = 0;         ///< Optional output count for tensor wrappers.
 };
 
+/**
+ * @brief Element type stored in a packed `.ndl` model container.
+ * @ingroup noodle_public
+ */
+enum NoodleDType : uint8_t {
+  NDL_DTYPE_F32 = 0,  ///< Little-endian IEEE-754 float32.
+  NDL_DTYPE_U8  = 1,  ///< Unsigned byte.
+  NDL_DTYPE_I8  = 2   ///< Signed byte.
+};
+
+/**
+ * @brief Packing order of a tensor in a `.ndl` model container.
+ * @ingroup noodle_public
+ */
+enum NoodleLayout : uint8_t {
+  NDL_LAYOUT_FLAT = 0,  ///< Plain vector, e.g. biases.
+  NDL_LAYOUT_OIHW = 1,  ///< 2D convolution weights `[O][I][K][K]`.
+  NDL_LAYOUT_CKK  = 2,  ///< Depthwise convolution weights `[C][K][K]`.
+  NDL_LAYOUT_OIK  = 3,  ///< 1D convolution weights `[O][I][K]`.
+  NDL_LAYOUT_OI   = 4,  ///< Fully connected weights `[O][I]`.
+  NDL_LAYOUT_BN   = 5   ///< Batch-norm vectors packed as gamma, beta, mean, var.
+};
+
+/**
+ * @brief Bytes reserved for a tensor name in a `.ndl` table entry.
+ * @ingroup noodle_public
+ */
+#define NOODLE_NDL_NAME 24
+
+/**
+ * @brief Open `.ndl` model container.
+ * @ingroup noodle_public
+ *
+ * Filled by noodle_model_open(). The container stays open until
+ * noodle_model_close(), so layers using ConvPacked or FCNPacked seek inside
+ * this one handle instead of opening a weight and a bias file per call.
+ *
+ * File layout, all integers little-endian:
+ *
+ * - header, 16 bytes: magic `"NDL1"`, `uint16` version (1), `uint16` tensor
+ *   count, `uint32` payload alignment, `uint32` reserved;
+ * - tensor table, 48 bytes per entry: `char name[24]` (NUL padded), `uint8`
+ *   dtype (NoodleDType), `uint8` layout (NoodleLayout), `uint8` rank, `uint8`
+ *   reserved, `uint16 dims[4]`, `uint32` absolute byte offset, `uint32`
+ *   element count, `uint32` reserved;
+ * - payloads, each starting at a multiple of the alignment (512 by default, one
+ *   SD sector). Payloads are always binary, regardless of `NOODLE_FILE_FORMAT`.
+ */
+struct NoodleModel {
+  NDL_File file;          ///< Open container handle.
+  uint16_t count = 0;     ///< Number of tensor table entries.
+  uint32_t align = 0;     ///< Payload alignment in bytes.
+};
+
+/**
+ * @brief One decoded `.ndl` tensor table entry.
+ * @ingroup noodle_public
+ */
+struct NoodleTensorInfo {
+  char name[NOODLE_NDL_NAME + 1];  ///< NUL-terminated tensor name.
+  uint8_t dtype = NDL_DTYPE_F32;   ///< Element type, a NoodleDType value.
+  uint8_t layout = NDL_LAYOUT_FLAT;  ///< Packing order, a NoodleLayout value.
+  uint8_t rank = 0;                ///< Number of used entries in @ref dims.
+  uint16_t dims[4] = {0, 0, 0, 0}; ///< Tensor dimensions, outermost first.
+  uint32_t offset = 0;             ///< Absolute byte offset of the payload.
+  uint32_t count = 0;              ///< Number of elements in the payload.
+};
+
+/**
+ * @brief Convolution parameter bundle backed by a `.ndl` model container.
+ * @ingroup noodle_public
+ *
+ * `weight` and `bias` are payload byte offsets, normally looked up once with
+ * noodle_model_offset(). Weights use the same packed order as Conv; a bias
+ * offset of 0 means zero bias.
+ */
+struct ConvPacked {
+  uint16_t K  = 3;       ///< Kernel width.
+  uint16_t P  = 0;       ///< Padding per side; `65535` requests SAME-style 2D padding.
+  uint16_t S  = 1;       ///< Convolution stride.
+  uint16_t OP = 0;       ///< Reserved output padding field for layout parity.
+
+  NoodleModel *model = nullptr;  ///< Open container holding the tensors.
+  uint32_t weight = 0;           ///< Byte offset of the float32 weights.
+  uint32_t bias   = 0;           ///< Byte offset of the float32 biases, or 0.
+
+  Activation act = ACT_RELU;     ///< Activation applied after adding bias.
+  uint16_t O = 0;                ///< Optional output channel count for tensor wrappers.
+};
+
+/**
+ * @brief Fully connected parameter bundle backed by a `.ndl` model container.
+ * @ingroup noodle_public
+ *
+ * `weight` is the byte offset of row-major `[O][I]` float32 weights; a bias
+ * offset of 0 means zero bias.
+ */
+struct FCNPacked {
+  NoodleModel *model = nullptr;  ///< Open container holding the tensors.
+  uint32_t weight = 0;           ///< Byte offset of the float32 weights.
+  uint32_t bias   = 0;           ///< Byte offset of the float32 biases, or 0.
+  Activation act = ACT_RELU;     ///< Activation applied after each output.
+  uint16_t O = 0;                ///< Optional output count for tensor wrappers.
+};
+
 // ============================================================
 // Filesystem and scalar I/O
 // ============================================================
@@ -346,6 +485,18 @@ void noodle_read_top_line(const char *fn, char *line, size_t maxlen);
  */
 void noodle_delete_file(const char *fn);
 
+/**
+ * @brief Close every read handle kept open by the weight/bias cache.
+ * @ingroup noodle_public
+ *
+ * Call it after replacing model files behind Noodle's back (Noodle's own
+ * writers and noodle_delete_file() drop stale entries themselves), before
+ * unmounting the filesystem, or to give the open-file slots back. Handles
+ * still in use by a running layer are closed when that layer releases them.
+ * No-op when `NOODLE_FS_CACHE` is 0.
+ */
+void noodle_fs_cache_clear();
+
 /**
  * @brief Read bytes until a terminator or until the buffer is full.
  * @ingroup noodle_public
@@ -394,6 +545,146 @@ byte noodle_read_byte(NDL_File &f);
  */
 void noodle_write_byte(NDL_File &f, byte d);
 
+// ============================================================
+// Packed model container
+// ============================================================
+
+/**
+ * @brief Open a `.ndl` model container and validate its header.
+ * @ingroup noodle_public
+ * @param model Container state to fill; its handle stays open on success.
+ * @param fn Container filename.
+ * @return true when the file opened and carries a supported header.
+ */
+bool noodle_model_open(NoodleModel &model, const char *fn);
+
+/**
+ * @brief Close a container opened with noodle_model_open().
+ * @ingroup noodle_public
+ * @param model Container to close.
+ */
+void noodle_model_close(NoodleModel &model);
+
+/**
+ * @brief Look up a tensor table entry by name.
+ * @ingroup noodle_public
+ * @param model Open container.
+ * @param name Tensor name, e.g. `"w01"`.
+ * @param info Destination for the decoded entry; may be nullptr.
+ * @return true when the tensor exists.
+ */
+bool noodle_model_find(NoodleModel &model, const char *name, NoodleTensorInfo *info);
+
+/**
+ * @brief Return the payload offset of a float32 tensor.
+ * @ingroup noodle_public
+ *
+ * Use the result to fill ConvPacked and FCNPacked once at setup.
+ *
+ * @param model Open container.
+ * @param name Tensor name.
+ * @return Byte offset, or 0 if the tensor is missing or not float32.
+ */
+uint32_t noodle_model_offset(NoodleModel &model, const char *name);
+
+// ============================================================
+// Mapped parameter source
+// ============================================================
+
+/**
+ * @brief Read-only memory mapping of a parameter file or flash partition.
+ * @ingroup noodle_public
+ *
+ * Point @ref ConvMem and @ref FCNMem at mapped float32 data to run the RAM
+ * kernels on file-backed weights without copying them through block buffers.
+ * While a mapping is open, layers whose weights fall inside it ask the OS to
+ * fault them in before computing.
+ */
+struct NoodleMap {
+  const uint8_t *data = nullptr;  ///< First mapped byte, or nullptr when closed.
+  size_t size = 0;                ///< Mapped length in bytes.
+  uint32_t handle = 0;            ///< Backend unmap handle, if any.
+};
+
+/**
+ * @brief Map a whole file read-only.
+ * @ingroup noodle_public
+ *
+ * Supported by the POSIX backend on hosts with `mmap()`; other backends
+ * return false. The file must hold binary float32 data, either a `.ndl`
+ * container or a raw `BIN` weight file.
+ *
+ * @param map Mapping state to fill.
+ * @param fn File to map.
+ * @return true on success.
+ */
+bool noodle_map_file(NoodleMap &map, const char *fn);
+
+/**
+ * @brief Map a flash data partition read-only (ESP32).
+ * @ingroup noodle_public
+ *
+ * Uses `esp_partition_mmap()` so weights flashed into a raw data partition,
+ * typically a `.ndl` image, are read through the flash cache. Needs ESP-IDF
+ * 4.0 or later for `esp_idf_version.h`; IDF 4.x and 5.0 (Arduino-ESP32 2.x)
+ * map through the `spi_flash_mmap` API, IDF 5.1+ (Arduino-ESP32 3.x) through
+ * the partition mapping types. Returns false on older IDF and other targets.
+ *
+ * @param map Mapping state to fill.
+ * @param label Partition label from the partition table.
+ * @return true on success.
+ */
+bool noodle_map_partition(NoodleMap &map, const char *label);
+
+/**
+ * @brief Release a mapping opened with noodle_map_file() or noodle_map_partition().
+ * @ingroup noodle_public
+ *
+ * Pointers taken from the mapping are invalid afterwards.
+ *
+ * @param map Mapping to close.
+ */
+void noodle_map_close(NoodleMap &map);
+
+/**
+ * @brief Look up a float32 tensor in a mapped `.ndl` container.
+ * @ingroup noodle_public
+ * @param map Mapping of a `.ndl` container.
+ * @param name Tensor name.
+ * @param info Destination for the decoded entry; may be nullptr.
+ * @return Pointer to the payload, or nullptr if missing or not float32.
+ */
+const float *noodle_map_tensor(const NoodleMap &map, const char *name,
+                               NoodleTensorInfo *info = nullptr);
+
+/**
+ * @brief Point a ConvMem at tensors in a mapped `.ndl` container.
+ * @ingroup noodle_public
+ *
+ * Only `weight` and `bias` are changed; set the geometry and activation as
+ * usual.
+ *
+ * @param map Mapping of a `.ndl` container.
+ * @param weight Weight tensor name.
+ * @param bias Bias tensor name, or nullptr for no bias.
+ * @param conv Parameters to update.
+ * @return true when every named tensor was found.
+ */
+bool noodle_map_conv(const NoodleMap &map, const char *weight, const char *bias,
+                     ConvMem &conv);
+
+/**
+ * @brief Point an FCNMem at tensors in a mapped `.ndl` container.
+ * @ingroup noodle_public
+ * @param map Mapping of a `.ndl` container.
+ * @param weight Weight tensor name.
+ * @param bias Bias tensor name, or nullptr for no bias.
+ * @param fcn Parameters to update.
+ * @return true when every named tensor was found.
+ */
+bool noodle_map_fcn(const NoodleMap &map, const char *weight, const char *bias,
+                    FCNMem &fcn);
+
 // ============================================================
 // Legacy/manual scratch buffers
 // ============================================================
@@ -430,6 +721,84 @@ void noodle_setup_temp_buffers(void *b2);
  */
 void noodle_temp_buffers_free(void);
 
+/**
+ * @brief Set the RAM budget for blocked file-input convolution.
+ * @ingroup noodle_public
+ *
+ * File-input Conv1D and Conv2D layers normally rewind and re-read the whole
+ * input file once per output channel. With a budget, the layer splits a
+ * Noodle-owned workspace between:
+ *
+ * - `R` resident input planes, read once and then served from RAM, so later
+ *   passes stream only the remaining planes from the file;
+ * - `B` output accumulators (plus the matching kernels when weights come from
+ *   a file or PROGMEM), so one pass over the input serves `B` output channels.
+ *
+ * `R` and `B` are chosen to minimize the number of planes read from the file.
+ * When the whole input fits and a RAM-input overload exists for the parameter
+ * type, the input is loaded once and that overload runs instead. The workspace
+ * is released by noodle_temp_buffers_free().
+ *
+ * @param bytes Workspace budget in bytes; 0 disables blocking.
+ */
+void noodle_set_conv_budget(size_t bytes);
+
+/**
+ * @brief Return the RAM budget for blocked file-input convolution.
+ * @ingroup noodle_public
+ * @return Budget in bytes, initially `NOODLE_CONV_BUDGET`.
+ */
+size_t noodle_get_conv_budget(void);
+
+/**
+ * @brief Return the instruction set used by the vectorized kernels.
+ * @ingroup noodle_public
+ *
+ * Detected on first use: `SIMD_AVX2` when the CPU has AVX2 and FMA, else
+ * `SIMD_SSE2` on x86, `SIMD_NEON` on AArch64, and `SIMD_SCALAR` when
+ * `NOODLE_SIMD` is 0.
+ */
+NoodleSimd noodle_simd_active(void);
+
+/**
+ * @brief Force the instruction set used by the vectorized kernels.
+ * @ingroup noodle_public
+ *
+ * `SIMD_SCALAR` runs the reference loops, for example to validate a target
+ * against them. Levels the CPU or build lacks fall back to the detected one.
+ *
+ * @param level Requested instruction set.
+ * @return The instruction set now in use.
+ */
+NoodleSimd noodle_simd_select(NoodleSimd level);
+
+/**
+ * @brief Transform 3x3 convolution weights for Winograd F(2x2,3x3).
+ * @ingroup noodle_public
+ *
+ * Computes `U = G g G^T` for every `[O][I][3][3]` kernel and stores the 16
+ * coefficients as `[16][O][I]`. Point `ConvMem::winograd` at the result (or at
+ * the `uXX` arrays written by `model_exporter.py --winograd`) to skip the
+ * transform and its heap cache at inference time.
+ *
+ * @param weight Packed `[O][I][3][3]` weights.
+ * @param n_inputs Number of input channels.
+ * @param n_outputs Number of output channels.
+ * @param out Destination for `16 * O * I` floats.
+ */
+void noodle_winograd_weights(const float *weight, uint16_t n_inputs,
+                             uint16_t n_outputs, float *out);
+
+/**
+ * @brief Free the Winograd weights transformed and cached at first use.
+ * @ingroup noodle_public
+ *
+ * Call it after freeing or overwriting weight arrays that ran with
+ * `CONV_ALGO_WINOGRAD`, since the cache is keyed by the weight pointer.
+ * noodle_temp_buffers_free() also clears it.
+ */
+void noodle_winograd_clear(void);
+
 // ============================================================
 // Simple utility I/O
 // ============================================================
@@ -628,6 +997,84 @@ uint16_t noodle_conv_float(const char *in_fn,
                            const Pool &pool,
                            CBFPtr progress_cb = NULL);
 
+/**
+ * @brief Run file-to-file 2D convolution with `.ndl` container parameters.
+ * @ingroup noodle_public
+ *
+ * Weights `[O][I][K][K]` and biases are read from `conv.model` by offset, so no
+ * parameter files are opened.
+ *
+ * @param in_fn Input file with packed `[I][W][W]` planes.
+ * @param n_inputs Number of input channels.
+ * @param n_outputs Number of output channels.
+ * @param out_fn Output file for packed `[O][Vout][Vout]` planes.
+ * @param W Input width and height.
+ * @param conv Container-backed convolution parameters.
+ * @param pool Pooling parameters applied after bias and activation.
+ * @param progress_cb Optional progress callback.
+ * @return Output width after pooling, or 0 on failure.
+ */
+uint16_t noodle_conv_float(const char *in_fn,
+                           uint16_t n_inputs,
+                           uint16_t n_outputs,
+                           const char *out_fn,
+                           uint16_t W,
+                           const ConvPacked &conv,
+                           const Pool &pool,
+                           CBFPtr progress_cb = NULL);
+
+/**
+ * @brief Run file-to-file 2D transpose convolution with file-backed parameters.
+ * @ingroup noodle_public
+ *
+ * Input planes are streamed from @p in_fn and only a few `[Vt][Vt]` output
+ * planes are resident at a time: within the conv budget (see
+ * noodle_set_conv_budget()) input planes and output accumulators are
+ * blocked like file-input Conv2D, otherwise one output plane is kept in
+ * temp_buff2. `conv.weight_fn` stores `[O][I][K][K]`. For explicit padding,
+ * set `conv.OP` so `Vt = (W - 1) * S - 2 * P + K + OP`.
+ *
+ * @param in_fn Input file with packed `[I][W][W]` planes.
+ * @param n_inputs Number of input channels.
+ * @param n_outputs Number of output channels.
+ * @param out_fn Output file for packed `[O][Vt][Vt]` planes.
+ * @param W Input width and height.
+ * @param conv File-backed transpose convolution parameters.
+ * @param progress_cb Optional progress callback.
+ * @return Output width, or 0 on failure.
+ */
+uint16_t noodle_conv_transpose_float(const char *in_fn,
+                                     uint16_t n_inputs,
+                                     uint16_t n_outputs,
+                                     const char *out_fn,
+                                     uint16_t W,
+                                     const Conv &conv,
+                                     CBFPtr progress_cb = NULL);
+
+/**
+ * @brief Run file-to-file 2D transpose convolution with memory-backed parameters.
+ * @ingroup noodle_public
+ *
+ * Same streaming as the file-parameter overload. `conv.weight` uses
+ * `[O][I][K][K]`; nullptr bias means zero bias.
+ *
+ * @param in_fn Input file with packed `[I][W][W]` planes.
+ * @param n_inputs Number of input channels.
+ * @param n_outputs Number of output channels.
+ * @param out_fn Output file for packed `[O][Vt][Vt]` planes.
+ * @param W Input width and height.
+ * @param conv Memory-backed transpose convolution parameters.
+ * @param progress_cb Optional progress callback.
+ * @return Output width, or 0 on failure.
+ */
+uint16_t noodle_conv_transpose_float(const char *in_fn,
+                                     uint16_t n_inputs,
+                                     uint16_t n_outputs,
+                                     const char *out_fn,
+                                     uint16_t W,
+                                     const ConvMem &conv,
+                                     CBFPtr progress_cb = NULL);
+
 /**
  * @brief Run file-to-file 1D convolution with file-backed parameters and pooling.
  * @ingroup noodle_public
@@ -700,6 +1147,117 @@ uint16_t noodle_conv1d(const char *in_fn,
                        const ConvMem &conv,
                        CBFPtr progress_cb = NULL);
 
+/**
+ * @brief Incremental state of one memory-backed Conv1D layer.
+ * @ingroup noodle_public
+ *
+ * Keeps the last `K - 1` input samples of every channel so that each call to
+ * noodle_conv1d_stream_push() computes only the outputs the new samples
+ * complete. With padding `P`, stream output `j` equals output `j` of the
+ * same layer run once over the whole signal with noodle_conv1d(); outputs
+ * trail the inputs by `K - 1 - P` samples, which are held back at the start.
+ * A stack of layers streams by pushing each layer's outputs into the next.
+ */
+struct NoodleConv1dStream {
+  const ConvMem *conv = nullptr;     ///< Layer parameters, kept by pointer.
+  uint16_t n_inputs = 0;             ///< Input channels.
+  uint16_t n_outputs = 0;            ///< Output channels.
+  uint16_t max_n = 0;                ///< Largest push accepted.
+  uint16_t skip = 0;                 ///< Leading outputs still held back.
+  NoodleBuffer hist = {NULL, 0};     ///< `[I][K - 1]` most recent inputs, oldest first.
+  NoodleBuffer work = {NULL, 0};     ///< `[I][K - 1 + max_n]` window of one push.
+};
+
+/**
+ * @brief Start streaming a Conv1D layer.
+ * @ingroup noodle_public
+ *
+ * Allocates the history and window buffers and grows the shared Conv1D
+ * kernel scratch once, so pushes do not touch the heap until
+ * noodle_temp_buffers_free() releases that scratch. Pushes never use buffers
+ * installed with noodle_setup_temp_buffers(). Only stride 1 and
+ * `P <= K - 1` can stream. @p conv must stay valid until
+ * noodle_conv1d_stream_end().
+ *
+ * @param st Stream state to fill.
+ * @param n_inputs Number of input channels.
+ * @param n_outputs Number of output channels.
+ * @param conv Memory-backed convolution parameters, `[O][I][K]` weights.
+ * @param max_n Largest number of samples per push.
+ * @return true on success.
+ */
+bool noodle_conv1d_stream_begin(NoodleConv1dStream &st,
+                                uint16_t n_inputs,
+                                uint16_t n_outputs,
+                                const ConvMem &conv,
+                                uint16_t max_n);
+
+/**
+ * @brief Feed new samples to a streaming Conv1D layer.
+ * @ingroup noodle_public
+ *
+ * @param st Stream state from noodle_conv1d_stream_begin().
+ * @param in New samples, packed `[I][n]`.
+ * @param n Number of new samples per channel, at most `max_n`.
+ * @param out Completed outputs, packed `[O][m]` with the returned `m`.
+ * @param progress_cb Optional progress callback.
+ * @return Number of outputs per channel, `n` once the start-up lag has
+ *         passed; 0 while it has not or on failure.
+ */
+uint16_t noodle_conv1d_stream_push(NoodleConv1dStream &st,
+                                   const float *in,
+                                   uint16_t n,
+                                   float *out,
+                                   CBFPtr progress_cb = NULL);
+
+/**
+ * @brief Restart a stream as if no samples had been pushed.
+ * @ingroup noodle_public
+ * @param st Stream state.
+ */
+void noodle_conv1d_stream_reset(NoodleConv1dStream &st);
+
+/**
+ * @brief Release the buffers of a stream.
+ * @ingroup noodle_public
+ * @param st Stream state.
+ */
+void noodle_conv1d_stream_end(NoodleConv1dStream &st);
+
+/**
+ * @brief Run a stride-1 Conv1D stack over a signal of any length.
+ * @ingroup noodle_public
+ *
+ * The result is what running the layers one after another with
+ * noodle_conv1d() would give if `W` were not limited to 16 bits. The final
+ * output is split into chunks of `NOODLE_CONV1D_CHUNK` samples; each chunk
+ * reads its inputs plus the receptive-field halo and runs the whole stack,
+ * so nothing but the input and the final output spans the signal. Layers
+ * with at least `NOODLE_CONV1D_FFT_K` taps use FFT overlap-save. Direct
+ * layers are bit-identical to noodle_conv1d().
+ *
+ * @param in Input signal, packed `[I][L]`.
+ * @param n_inputs Number of input channels.
+ * @param L Input length.
+ * @param layers Layer parameters; `layers[l].O` gives each layer's output
+ *        channels, `S` must be 1 and pooling is not applied.
+ * @param n_layers Number of layers.
+ * @param out Output, packed `[O][Lout]` for the last layer's `O`.
+ * @param n_threads Workers including the caller, used when
+ *        `NOODLE_CONV1D_THREADS` is set.
+ * @param progress_cb Optional progress callback, called per finished chunk
+ *        from the calling thread.
+ * @return Output length `Lout`, or 0 on failure.
+ */
+uint32_t noodle_conv1d_long(const float *in,
+                            uint16_t n_inputs,
+                            uint32_t L,
+                            const ConvMem *layers,
+                            uint8_t n_layers,
+                            float *out,
+                            uint8_t n_threads = 1,
+                            CBFPtr progress_cb = NULL);
+
 /**
  * @brief Run file-to-file depthwise 2D convolution with file-backed parameters.
  * @ingroup noodle_public
@@ -747,6 +1305,29 @@ uint16_t noodle_dwconv_float(const char *in_fn,
                              const Pool &pool,
                              CBFPtr progress_cb = NULL);
 
+/**
+ * @brief Run file-to-file depthwise 2D convolution with `.ndl` container parameters.
+ * @ingroup noodle_public
+ *
+ * Weights `[C][K][K]` and biases are read from `conv.model` by offset.
+ *
+ * @param in_fn Input file with packed `[C][W][W]` planes.
+ * @param n_channels Number of channels.
+ * @param out_fn Output file for packed `[C][Vout][Vout]` planes.
+ * @param W Input width and height.
+ * @param conv Container-backed depthwise parameters.
+ * @param pool Pooling parameters applied after bias and activation.
+ * @param progress_cb Optional progress callback.
+ * @return Output width after pooling, or 0 on failure.
+ */
+uint16_t noodle_dwconv_float(const char *in_fn,
+                             uint16_t n_channels,
+                             const char *out_fn,
+                             uint16_t W,
+                             const ConvPacked &conv,
+                             const Pool &pool,
+                             CBFPtr progress_cb = NULL);
+
 /**
  * @brief Run a fully connected layer from int8 memory to a file.
  * @ingroup noodle_public
@@ -987,6 +1568,26 @@ uint16_t noodle_dwconv2d(NoodleTensor *input,
                          const ConvProgmem &conv,
                          const Pool &pool);
 
+/**
+ * @brief Run a fused depthwise + 1x1 block on NoodleTensor input.
+ * @ingroup noodle_public
+ *
+ * Input must be a rank-2 packed `[C][W][W]` tensor. @p pw must provide a
+ * nonzero `O`; on success @p output becomes rank-2 `[O][Wout][Wout]`.
+ *
+ * @param input Rank-2 input tensor.
+ * @param output Output tensor grown and reshaped on success.
+ * @param dw Memory-backed depthwise parameters.
+ * @param pw Memory-backed 1x1 parameters.
+ * @param pool Pooling applied after the pointwise layer.
+ * @return Output width after pooling, or 0 on invalid input/allocation failure.
+ */
+uint16_t noodle_dwpw2d(NoodleTensor *input,
+                       NoodleTensor *output,
+                       const ConvMem &dw,
+                       const ConvMem &pw,
+                       const Pool &pool);
+
 /**
  * @brief Apply 2D pooling to a rank-2 NoodleTensor.
  * @ingroup noodle_public
@@ -1221,6 +1822,31 @@ uint16_t noodle_conv_float(NoodleBuffer *input,
                            const Pool &pool,
                            CBFPtr progress_cb = NULL);
 
+/**
+ * @brief Run 2D convolution using `.ndl` container parameters.
+ * @ingroup noodle_public
+ *
+ * Weights `[O][I][K][K]` and biases are read from `conv.model` by offset.
+ *
+ * @param input Input NoodleBuffer with packed `[I][W][W]` feature maps.
+ * @param n_inputs Number of input channels.
+ * @param n_outputs Number of output channels.
+ * @param output Output NoodleBuffer grown as needed.
+ * @param W Input width and height.
+ * @param conv Container-backed convolution parameters.
+ * @param pool Pooling parameters.
+ * @param progress_cb Optional progress callback.
+ * @return Output width after pooling, or 0 on failure.
+ */
+uint16_t noodle_conv_float(NoodleBuffer *input,
+                           uint16_t n_inputs,
+                           uint16_t n_outputs,
+                           NoodleBuffer *output,
+                           uint16_t W,
+                           const ConvPacked &conv,
+                           const Pool &pool,
+                           CBFPtr progress_cb = NULL);
+
 /**
  * @brief Run 1D convolution using memory-backed parameters.
  * @ingroup noodle_public
@@ -1339,6 +1965,60 @@ uint16_t noodle_dwconv_float(NoodleBuffer *input,
                              const Pool &pool,
                              CBFPtr progress_cb = NULL);
 
+/**
+ * @brief Run depthwise 2D convolution using `.ndl` container parameters.
+ * @ingroup noodle_public
+ *
+ * Weights `[C][K][K]` and biases are read from `conv.model` by offset.
+ *
+ * @param input Input NoodleBuffer with packed `[C][W][W]` planes.
+ * @param n_channels Number of channels.
+ * @param output Output NoodleBuffer grown as needed.
+ * @param W Input width and height.
+ * @param conv Container-backed depthwise parameters.
+ * @param pool Pooling parameters.
+ * @param progress_cb Optional progress callback.
+ * @return Output width after pooling, or 0 on failure.
+ */
+uint16_t noodle_dwconv_float(NoodleBuffer *input,
+                             uint16_t n_channels,
+                             NoodleBuffer *output,
+                             uint16_t W,
+                             const ConvPacked &conv,
+                             const Pool &pool,
+                             CBFPtr progress_cb = NULL);
+
+/**
+ * @brief Run a depthwise conv and the following 1x1 conv as one block.
+ * @ingroup noodle_public
+ *
+ * Equivalent to noodle_dwconv_float() with identity pooling followed by a
+ * pointwise noodle_conv_float(), but the `[C][V][V]` depthwise map is only
+ * ever held a band of rows at a time in temp_buff3. `dw.weight` stores
+ * `[C][K][K]` and `pw.weight` stores `[O][C]`; @p pw must be 1x1, stride 1
+ * and unpadded.
+ *
+ * @param input Input NoodleBuffer with packed `[C][W][W]` planes.
+ * @param n_channels Number of depthwise channels.
+ * @param n_outputs Number of pointwise output channels.
+ * @param output Output NoodleBuffer grown as needed.
+ * @param W Input width and height.
+ * @param dw Memory-backed depthwise parameters.
+ * @param pw Memory-backed pointwise parameters.
+ * @param pool Pooling applied after the pointwise layer.
+ * @param progress_cb Optional progress callback.
+ * @return Output width after pooling, or 0 on failure.
+ */
+uint16_t noodle_dwpw_float(NoodleBuffer *input,
+                           uint16_t n_channels,
+                           uint16_t n_outputs,
+                           NoodleBuffer *output,
+                           uint16_t W,
+                           const ConvMem &dw,
+                           const ConvMem &pw,
+                           const Pool &pool,
+                           CBFPtr progress_cb = NULL);
+
 /**
  * @brief Run 2D transpose convolution using memory-backed parameters.
  * @ingroup noodle_public
@@ -1424,6 +2104,28 @@ uint16_t noodle_fcn(NoodleBuffer *input,
                     const FCNProgmem &fcn,
                     CBFPtr progress_cb = NULL);
 
+/**
+ * @brief Run a fully connected layer using `.ndl` container parameters.
+ * @ingroup noodle_public
+ *
+ * Weights are streamed from `fcn.model` in one sequential pass, then the
+ * biases in a second one.
+ *
+ * @param input Input NoodleBuffer containing a flat vector.
+ * @param n_inputs Input vector length.
+ * @param n_outputs Number of output neurons.
+ * @param output Output NoodleBuffer grown to @p n_outputs floats.
+ * @param fcn Container-backed FCN parameters.
+ * @param progress_cb Optional progress callback.
+ * @return @p n_outputs, or 0 on failure.
+ */
+uint16_t noodle_fcn(NoodleBuffer *input,
+                    uint16_t n_inputs,
+                    uint16_t n_outputs,
+                    NoodleBuffer *output,
+                    const FCNPacked &fcn,
+                    CBFPtr progress_cb = NULL);
+
 /**
  * @brief Run a fully connected layer from byte memory to a NoodleBuffer.
  * @ingroup noodle_public
@@ -1907,3 +2609,70 @@ uint16_t noodle_bn_relu(NoodleBuffer *x, uint16_t C, uint16_t W,
  */
 uint16_t noodle_bn_relu(NoodleBuffer *x, uint16_t C, uint16_t W,
                         const float *bn_params, float eps);
+
+/**
+ * @brief Fold inference batch normalization into weights and biases in place.
+ * @ingroup noodle_public
+ *
+ * For each output `o`, with `s = gamma[o] / sqrtf(var[o] + eps)`, scales the
+ * @p n_weights values of row `o` by `s` and sets
+ * `bias[o] = s * bias[o] + beta[o] - s * mean[o]`. The layer then produces
+ * what the layer followed by noodle_bn2d()/noodle_bn1d() produced, so the
+ * separate normalization pass and its per-inference square roots go away.
+ * Only valid when the layer is linear before the normalization; use
+ * `ACT_RELU` on the layer in place of noodle_bn2d_relu()/noodle_bn1d_relu().
+ *
+ * @param weight Weights packed with the output channel outermost.
+ * @param bias @p n_outputs biases; zero-fill it if the layer had none.
+ * @param n_outputs Number of output channels.
+ * @param n_weights Weights per output channel: `I*K*K` for Conv2D, `I*K` for
+ *        Conv1D, `K*K` for depthwise Conv2D, `I` for FCN.
+ * @param bn_params Packed `[gamma[O]][beta[O]][mean[O]][var[O]]` parameters.
+ * @param eps Small value added to variance before inversion.
+ * @return true on success, false when a pointer is null.
+ */
+bool noodle_fold_bn(float *weight, float *bias,
+                    uint16_t n_outputs, uint32_t n_weights,
+                    const float *bn_params, float eps);
+
+/**
+ * @brief Fold batch normalization into a memory-backed convolution layer.
+ * @ingroup noodle_public
+ *
+ * Copies `conv.weight` and `conv.bias` into the writable @p weight and
+ * @p bias arrays (zeros when `conv.bias` is null; no copy when they are the
+ * same arrays), folds @p bn_params into them as noodle_fold_bn() does, and
+ * points `conv` at them. `conv.winograd` is cleared and the Winograd weight
+ * cache is flushed because both describe the old weights.
+ *
+ * @param conv Convolution parameters to rewrite.
+ * @param n_outputs Number of output channels.
+ * @param n_weights Weights per output channel, see noodle_fold_bn().
+ * @param weight Writable `n_outputs * n_weights` destination.
+ * @param bias Writable @p n_outputs destination.
+ * @param bn_params Packed `[gamma[O]][beta[O]][mean[O]][var[O]]` parameters.
+ * @param eps Small value added to variance before inversion.
+ * @return true on success, false when a pointer is null.
+ */
+bool noodle_fold_bn(ConvMem &conv, uint16_t n_outputs, uint32_t n_weights,
+                    float *weight, float *bias,
+                    const float *bn_params, float eps);
+
+/**
+ * @brief Fold batch normalization into a memory-backed fully connected layer.
+ * @ingroup noodle_public
+ *
+ * Same as the ConvMem overload for `[O][I]` weights.
+ *
+ * @param fcn Fully connected parameters to rewrite.
+ * @param n_inputs Number of inputs.
+ * @param n_outputs Number of outputs.
+ * @param weight Writable `n_outputs * n_inputs` destination.
+ * @param bias Writable @p n_outputs destination.
+ * @param bn_params Packed `[gamma[O]][beta[O]][mean[O]][var[O]]` parameters.
+ * @param eps Small value added to variance before inversion.
+ * @return true on success, false when a pointer is null.
+ */
+bool noodle_fold_bn(FCNMem &fcn, uint16_t n_inputs, uint16_t n_outputs,
+                    float *weight, float *bias,
+                    const float *bn_params, float eps);
@@ -2,7 +2,7 @@
 
 // Filesystem backend selection (exactly one)
 // If the user didn't pick anything (including NONE), pick a default.
-#if !defined(NOODLE_USE_SD_MMC) && !defined(NOODLE_USE_SDFAT) && !defined(NOODLE_USE_FFAT) && !defined(NOODLE_USE_LITTLEFS) && !defined(NOODLE_USE_NONE)
+#if !defined(NOODLE_USE_SD_MMC) && !defined(NOODLE_USE_SDFAT) && !defined(NOODLE_USE_FFAT) && !defined(NOODLE_USE_LITTLEFS) && !defined(NOODLE_USE_POSIX) && !defined(NOODLE_USE_RAMDISK) && !defined(NOODLE_USE_NONE)
   #define NOODLE_USE_SDFAT
 #endif
 
@@ -71,6 +71,246 @@
   #define NOODLE_FCN_BLOCK 128
 #endif
 
+#ifndef NOODLE_IO_CHUNK
+  /**
+   * @brief Bytes staged per read when loading grids and arrays from files.
+   *
+   * Byte and int8 grid loaders read float32 data into a stack chunk of this
+   * size and convert in RAM. Text mode reads this many characters at a time
+   * and parses whole lines from the chunk. Larger values mean fewer filesystem
+   * calls and more stack use.
+   */
+  #define NOODLE_IO_CHUNK 256
+#endif
+
+#ifndef NOODLE_WRITE_BUFFER
+  /**
+   * @brief Bytes coalesced before a layer's binary output reaches the file.
+   *
+   * File-output layers and the grid/array writers append float32 results to a
+   * write-behind buffer and hand it to the backend in blocks of this size,
+   * flushing once at layer end. Keep it a multiple of the 512-byte SD sector.
+   * Set to 0 to write every value directly. Text mode is not buffered.
+   */
+  #define NOODLE_WRITE_BUFFER 512
+#endif
+
+#ifndef NOODLE_WRITE_THREAD
+  /**
+   * @brief Drain write-behind blocks on a background pthread when set to 1.
+   *
+   * Doubles the write-behind storage so compute can fill one block while the
+   * other is written. Needs pthreads (host builds, Arduino-ESP32/ESP-IDF) and a
+   * backend that tolerates concurrent access to different files, so it is
+   * rejected for SdFat, the RAM-disk simulator, and `NOODLE_USE_NONE`.
+   */
+  #define NOODLE_WRITE_THREAD 0
+#endif
+
+#if NOODLE_WRITE_THREAD
+  #if NOODLE_WRITE_BUFFER == 0
+    #error "NOODLE_WRITE_THREAD requires NOODLE_WRITE_BUFFER > 0"
+  #endif
+  #if defined(NOODLE_USE_SDFAT) || defined(NOODLE_USE_RAMDISK) || defined(NOODLE_USE_NONE)
+    #error "NOODLE_WRITE_THREAD is not supported by the selected filesystem backend"
+  #endif
+#endif
+
+#ifndef NOODLE_PREFETCH
+  /**
+   * @brief Prefetch input planes and weights on a reader thread when set to 1.
+   *
+   * File-backed conv, depthwise and FCN loops read through a block stream.
+   * With prefetch enabled each stream gets a reader (a pthread on hosts, a
+   * FreeRTOS task on ESP32) that fills the next ring slots while the current
+   * block is being computed. Same backend restrictions as
+   * `NOODLE_WRITE_THREAD`.
+   */
+  #define NOODLE_PREFETCH 0
+#endif
+
+#ifndef NOODLE_PREFETCH_DEPTH
+  /**
+   * @brief Ring slots per prefetched input-plane stream (2 = double buffering).
+   *
+   * Each extra slot costs one input plane of heap. Weight streams use one slot
+   * per input channel so a whole output channel's kernels can be in flight.
+   */
+  #define NOODLE_PREFETCH_DEPTH 2
+#endif
+
+#if NOODLE_PREFETCH
+  #if defined(NOODLE_USE_SDFAT) || defined(NOODLE_USE_RAMDISK) || defined(NOODLE_USE_NONE)
+    #error "NOODLE_PREFETCH is not supported by the selected filesystem backend"
+  #endif
+  #if NOODLE_PREFETCH_DEPTH < 2
+    #error "NOODLE_PREFETCH_DEPTH must be at least 2"
+  #endif
+#endif
+
+#ifndef NOODLE_FS_CACHE
+  /**
+   * @brief Number of weight/bias read handles kept open between layer calls.
+   *
+   * File-backed layers check their weight and bias files out of a small LRU
+   * cache keyed by path. A hit rewinds the open handle instead of paying for a
+   * directory lookup; the least recently used idle handle is closed when the
+   * cache is full. Every slot holds one open file, so keep the value below the
+   * backend's open-file limit minus the input, output and model handles. Size
+   * it to twice the number of file-backed layers to avoid reopening anything
+   * across repeated inferences. 0 disables the cache.
+   */
+  #define NOODLE_FS_CACHE 0
+#endif
+
+#ifndef NOODLE_CONV_BUDGET
+  /**
+   * @brief Default RAM budget, in bytes, for blocked file-input convolution.
+   *
+   * File-input Conv1D/Conv2D layers split this budget between resident input
+   * planes and output-channel accumulators (with their kernels for file or
+   * PROGMEM weights) to cut how often the input file is re-read. 0 keeps the
+   * one-channel-per-pass behavior. Can be changed at runtime with
+   * noodle_set_conv_budget().
+   */
+  #define NOODLE_CONV_BUDGET 0
+#endif
+
+#ifndef NOODLE_CONV_SPECIALIZE
+  /**
+   * @brief Use compile-time specialized 2D convolution kernels when set to 1.
+   *
+   * Kernel widths 1, 3 and 5 with stride 1 or 2 run through instances with
+   * fully unrolled taps; other shapes use the generic kernel. Each instance
+   * adds flash, so the default is 0 on AVR and 1 elsewhere.
+   */
+  #if defined(__AVR__)
+    #define NOODLE_CONV_SPECIALIZE 0
+  #else
+    #define NOODLE_CONV_SPECIALIZE 1
+  #endif
+#endif
+
+#ifndef NOODLE_CONV_OBLOCK
+  /**
+   * @brief Output channels computed per input sweep by RAM-to-RAM convolution.
+   *
+   * The direct `ConvMem` kernel accumulates this many output planes at once,
+   * reusing each loaded input value for all of them. It needs
+   * `NOODLE_CONV_OBLOCK * (R * V + I * K * K)` floats of scratch, where R is
+   * the pool window M when the pool stride is at least M (1 without pooling)
+   * and V otherwise; Conv1D needs `NOODLE_CONV_OBLOCK * (V + I * K) + V`.
+   * 1 keeps the one-channel-at-a-time loop, which is the default on AVR.
+   */
+  #if defined(__AVR__)
+    #define NOODLE_CONV_OBLOCK 1
+  #else
+    #define NOODLE_CONV_OBLOCK 8
+  #endif
+#endif
+
+#ifndef NOODLE_SIMD
+  /**
+   * @brief Build the SSE2/AVX2/NEON kernels when set to 1.
+   *
+   * Needs GCC or Clang on x86 with SSE2 or on AArch64. Dot products,
+   * convolution rows, 2x2 pooling, batch normalization and bias/activation
+   * then pick the widest instruction set the CPU reports at run time (AVX2
+   * with FMA, else SSE2; NEON on AArch64). The scalar loops remain the
+   * reference and are used when this is 0 or after
+   * `noodle_simd_select(SIMD_SCALAR)`.
+   */
+  #if (defined(__GNUC__) || defined(__clang__)) && (defined(__SSE2__) || defined(__aarch64__))
+    #define NOODLE_SIMD 1
+  #else
+    #define NOODLE_SIMD 0
+  #endif
+#endif
+
+#ifndef NOODLE_IM2COL_BUFFER
+  /**
+   * @brief Bytes of column scratch used by the im2col convolution path.
+   *
+   * RAM-to-RAM Conv2D with `CONV_ALGO_IM2COL` lowers as many output rows at
+   * a time as fit in this many bytes of `[I*K*K][rows*V]` columns (at least
+   * one row), then multiplies them against the weights with one SGEMM call.
+   * Conv1D lowers bands of output samples into `[I*K][n]` columns the same
+   * way.
+   */
+  #define NOODLE_IM2COL_BUFFER 32768
+#endif
+
+#ifndef NOODLE_WINOGRAD_BUFFER
+  /**
+   * @brief Bytes of tile scratch used by the Winograd convolution path.
+   *
+   * 3x3 stride-1 RAM-to-RAM Conv2D with `CONV_ALGO_WINOGRAD` transforms as
+   * many rows of 2x2 output tiles at a time as fit in this many bytes of
+   * `[16][I + O][tiles]` scratch (at least one tile row).
+   */
+  #define NOODLE_WINOGRAD_BUFFER 32768
+#endif
+
+#ifndef NOODLE_WINOGRAD_CACHE
+  /**
+   * @brief Layers whose transformed Winograd weights are cached on the heap.
+   *
+   * `CONV_ALGO_WINOGRAD` layers without precomputed `ConvMem::winograd`
+   * weights transform them on first use and keep `16 * O * I` floats per
+   * layer, keyed by the weight pointer. The oldest entry is freed when the
+   * cache is full. 0 transforms the weights on every call instead.
+   */
+  #define NOODLE_WINOGRAD_CACHE 8
+#endif
+
+#ifndef NOODLE_DWPW_BUFFER
+  /**
+   * @brief Bytes of depthwise row scratch used by noodle_dwpw_float().
+   *
+   * A fused depthwise + 1x1 block without pooling computes as many depthwise
+   * rows of all C channels at a time as fit in this many bytes (at least
+   * one row) and passes them to the pointwise SGEMM. Larger bands mean
+   * longer SGEMM calls; the `[C][V][V]` intermediate is never stored.
+   */
+  #define NOODLE_DWPW_BUFFER 8192
+#endif
+
+#ifndef NOODLE_CONV1D_CHUNK
+  /**
+   * @brief Final-layer samples per chunk of noodle_conv1d_long().
+   *
+   * Each chunk recomputes the receptive-field halo of the stack on both
+   * sides, so larger chunks waste less work but need more scratch per worker
+   * (about `2 * C * (chunk + halo)` floats for the widest channel count C).
+   * Chunks are shortened so every layer input stays below 65536 samples.
+   */
+  #define NOODLE_CONV1D_CHUNK 4096
+#endif
+
+#ifndef NOODLE_CONV1D_FFT_K
+  /**
+   * @brief Smallest Conv1D kernel length that noodle_conv1d_long() runs by FFT.
+   *
+   * Layers with at least this many taps use overlap-save with FFTs of the
+   * smallest power of two of at least `4 * K`, keeping `O * I` kernel spectra
+   * for the call. FFT results match the direct kernel to rounding, not bit
+   * for bit. 0 keeps every layer on the direct kernel.
+   */
+  #define NOODLE_CONV1D_FFT_K 32
+#endif
+
+#ifndef NOODLE_CONV1D_THREADS
+  /**
+   * @brief Let noodle_conv1d_long() spread chunks over pthreads when set to 1.
+   *
+   * The calling thread and up to `n_threads - 1` extra workers claim chunks
+   * from a shared counter; each worker has its own scratch, so the global
+   * temp buffers are not touched. Needs pthreads (host builds,
+   * Arduino-ESP32/ESP-IDF). With 0 the `n_threads` argument is ignored.
+   */
+  #define NOODLE_CONV1D_THREADS 0
+#endif
+
 #ifndef NOODLE_MAX_K
   /**
    * @brief Largest convolution kernel width copied into fixed stack scratch.
@@ -8,6 +8,326 @@
  */
 #include "noodle_internal.h"
 
+// Identity pooling: the convolution plane is the output plane, so RAM-output
+// layers accumulate straight into it.
+static inline bool noodle_pool_is_identity(const Pool &pool) {
+#if NOODLE_POOL_MODE == NOODLE_POOL_NONE
+  return true;
+#else
+  return pool.M == 1 && pool.T == 1;
+#endif
+}
+
+// ===== Blocked and input-resident passes for file-input layers =====
+//
+// File-input layers normally rewind fi and re-read every input plane once per
+// output channel. Within the conv budget, a planned pass instead
+//  - keeps the first R input planes resident after the first read, so later
+//    passes only stream planes R..I-1 from fi, and
+//  - keeps B output accumulators, so each pass over the input serves B
+//    output channels.
+// Workspace layout (temp buffer 3):
+//   [R resident planes][B accumulators][B staged kernel sets][B biases].
+
+// Parameter source for a planned pass. weight == NULL means fw/fb.
+typedef struct {
+  const float *weight;
+  const float *bias;
+  bool progmem;
+} NoodleConvSrc;
+
+// Split the conv budget between R resident input planes and B output
+// accumulators so the fewest planes are read from fi. With ram_kernel set, an
+// input that fits entirely is planned as R = n_inputs, B = 0 so the caller can
+// hand it to the RAM-input kernel. Returns the workspace, or NULL (R = 0,
+// B = 1) when the unblocked loop is at least as good or allocation fails.
+static float *noodle_conv_plan(uint16_t n_inputs,
+                               uint16_t n_outputs,
+                               uint32_t in_plane_floats,
+                               uint32_t per_output_floats,
+                               bool ram_kernel,
+                               uint16_t &R,
+                               uint16_t &B) {
+  R = 0;
+  B = 1;
+  const size_t budget = conv_budget / sizeof(float);
+  if (budget == 0 || n_outputs < 2 || n_inputs == 0) return NULL;
+
+  const uint64_t all_planes = (uint64_t)n_inputs * in_plane_floats;
+  size_t need = 0;
+
+  if (ram_kernel && all_planes <= budget) {
+    R = n_inputs;
+    B = 0;
+    need = (size_t)all_planes;
+  } else {
+    uint64_t best = (uint64_t)n_inputs * n_outputs;  // unblocked plane reads
+
+    for (uint32_t r = 0; r <= n_inputs; r++) {
+      const uint64_t used = (uint64_t)r * in_plane_floats;
+      if (used + per_output_floats > budget) break;
+
+      uint64_t b = (budget - used) / per_output_floats;
+      if (b > n_outputs) b = n_outputs;
+      if (r == 0 && b < 2) continue;
+
+      const uint64_t passes = (n_outputs + b - 1) / b;
+      const uint64_t reads = n_inputs + (passes - 1) * (n_inputs - r);
+      if (reads < best) {
+        best = reads;
+        R = (uint16_t)r;
+        B = (uint16_t)b;
+      }
+    }
+    if (R == 0 && B == 1) return NULL;
+    need = (size_t)R * in_plane_floats + (size_t)B * per_output_floats;
+  }
+
+  float *ws = noodle_temp3_require(need);
+  if (!ws) {
+    R = 0;
+    B = 1;
+  }
+  return ws;
+}
+
+// Load biases and kernels for outputs [O0, O0 + nb). RAM weights are used in
+// place; file and PROGMEM weights are copied into stage as [nb][per_out].
+static const float *noodle_conv_block_params(const NoodleConvSrc &src,
+                                             uint16_t O0,
+                                             uint16_t nb,
+                                             uint32_t per_out,
+                                             uint16_t K,
+                                             float *stage,
+                                             float *bias) {
+  if (!src.weight) {
+    for (uint16_t b = 0; b < nb; b++) bias[b] = noodle_read_float(fb);
+
+    const uint32_t n = (uint32_t)nb * per_out;
+    uint32_t got = (uint32_t)noodle_read_float_block(fw, stage, n);
+    while (got < n) stage[got++] = 0.0f;
+    return stage;
+  }
+
+  for (uint16_t b = 0; b < nb; b++) {
+    const uint16_t O = (uint16_t)(O0 + b);
+    if (!src.bias) bias[b] = 0.0f;
+    else bias[b] = src.progmem ? noodle_pgm_float(src.bias, O) : src.bias[O];
+  }
+
+  if (!src.progmem) return src.weight + (uint32_t)O0 * per_out;
+
+  const uint32_t KK = (uint32_t)K * K;
+  for (uint32_t k = 0; k < (uint32_t)nb * per_out; k += KK) {
+    noodle_copy_kernel_progmem(src.weight, (uint32_t)O0 * per_out + k, K, stage + k);
+  }
+  return stage;
+}
+
+// Position fi at input plane R for the next pass. The first pass reads from
+// the start; later passes seek past the resident planes.
+static void noodle_conv_seek_stream(uint16_t R, uint32_t stream_pos) {
+  if (R == 0) noodle_rewind_file(fi);
+  else noodle_seek_file(fi, stream_pos);
+}
+
+// File-input Conv2D as a planned pass over R resident planes and blocks of B
+// output channels. Input planes are byte or float depending on in_byte.
+// Pooled planes go to output (packed [O][Wo][Wo]) when it is non-NULL,
+// otherwise to fo.
+static uint16_t noodle_conv2d_planned(void *in_buffer,
+                                      bool in_byte,
+                                      uint16_t n_inputs,
+                                      uint16_t n_outputs,
+                                      uint16_t W,
+                                      uint16_t K,
+                                      uint16_t P,
+                                      uint16_t S,
+                                      Activation act,
+                                      const NoodleConvSrc &src,
+                                      const Pool &pool,
+                                      float *output,
+                                      float *ws,
+                                      uint16_t R,
+                                      uint16_t B,
+                                      CBFPtr progress_cb,
+                                      float progress_step) {
+  const uint16_t Vconv = noodle_compute_V(K, W, P, S);
+  const bool identity = noodle_pool_is_identity(pool);
+  const uint16_t M = identity ? 1 : pool.M;
+  const uint16_t T = identity ? 1 : pool.T;
+  if (T == 0 || Vconv < M) return 0;
+  const uint32_t plane = (uint32_t)Vconv * Vconv;
+  const uint32_t in_plane = (uint32_t)W * W;
+  const uint32_t in_plane_floats = in_byte ? (in_plane + 3) / 4 : in_plane;
+  const uint32_t per_out = (uint32_t)n_inputs * K * K;
+  const uint32_t KK = (uint32_t)K * K;
+  const bool staged = (src.weight == NULL) || src.progmem;
+
+  uint8_t *cache = (uint8_t *)ws;
+  const uint32_t cache_stride = in_plane_floats * sizeof(float);
+  float *acc = ws + (uint32_t)R * in_plane_floats;
+  float *stage = acc + (uint32_t)B * plane;
+  float *bias = stage + (staged ? (uint32_t)B * per_out : 0);
+
+  const uint16_t Wo = (uint16_t)((Vconv - M) / T + 1);
+  uint16_t Vout = 0;
+  uint32_t stream_pos = 0;
+  float progress = 0.0f;
+
+  for (uint16_t O0 = 0; O0 < n_outputs; O0 = (uint16_t)(O0 + B)) {
+    const uint16_t nb = (n_outputs - O0 < B) ? (uint16_t)(n_outputs - O0) : B;
+    const float *wblock = noodle_conv_block_params(src, O0, nb, per_out, K, stage, bias);
+
+    for (uint32_t i = 0; i < (uint32_t)nb * plane; i++) acc[i] = 0.0f;
+
+    if (O0 == 0) noodle_rewind_file(fi);
+    else noodle_conv_seek_stream(R, stream_pos);
+
+    for (uint16_t I = 0; I < n_inputs; I++) {
+      void *in = in_buffer;
+      if (I < R) {
+        in = cache + (uint32_t)I * cache_stride;
+        if (O0 == 0) {
+          if (in_byte) noodle_grid_from_file(fi, (byte *)in, W);
+          else noodle_grid_from_file(fi, (float *)in, W);
+          if (I + 1 == R) stream_pos = (uint32_t)fi.position();
+        }
+      } else {
+        if (in_byte) noodle_grid_from_file(fi, (byte *)in, W);
+        else noodle_grid_from_file(fi, (float *)in, W);
+      }
+
+      for (uint16_t b = 0; b < nb; b++) {
+        const float *kernel = wblock + (uint32_t)b * per_out + (uint32_t)I * KK;
+        if (in_byte) noodle_do_conv((byte *)in, kernel, K, W, acc + b * plane, P, S);
+        else noodle_do_conv((float *)in, kernel, K, W, acc + b * plane, P, S);
+
+        if (progress_cb) {
+          progress_cb(progress);
+          progress += progress_step;
+        }
+      }
+    }
+
+    for (uint16_t b = 0; b < nb; b++) {
+      float *plane_acc = acc + b * plane;
+      if (output) {
+        Vout = noodle_do_bias_act_pool(plane_acc, bias[b], Vconv, act, M, T,
+                                       noodle_slice(output, Wo, O0 + b));
+      } else {
+        noodle_do_bias_act(plane_acc, bias[b], Vconv, act);
+        Vout = noodle_do_pooling(plane_acc, Vconv, M, T, fo);
+      }
+    }
+  }
+
+  return Vout;
+}
+
+// Read the whole packed float input from fi into a resident [I][W][W] buffer.
+static void noodle_conv_load_input(float *dst, uint16_t n_inputs, uint32_t plane_len, bool grid, uint16_t W) {
+  for (uint16_t I = 0; I < n_inputs; I++) {
+    if (grid) noodle_grid_from_file(fi, dst + (uint32_t)I * plane_len, W);
+    else noodle_array_from_file(fi, dst + (uint32_t)I * plane_len, W);
+  }
+}
+
+// Conv1D accumulator length: the unblocked paths clear W samples, but the
+// convolution can produce up to Vmax when padding is large.
+static uint16_t noodle_conv1d_acc_len(uint16_t W, uint16_t K, uint16_t P, uint16_t S) {
+  const uint16_t Vmax = (uint16_t)((W - K + 2 * P) / S + 1);
+  return (Vmax > W) ? Vmax : W;
+}
+
+// File-input Conv1D as a planned pass over R resident sequences and blocks of
+// B output channels. Accumulators are Vacc samples long. With pool non-NULL
+// each channel is max-pooled into fo; otherwise raw samples go to output
+// ([O][Vmax]) or, when NULL, to fo.
+static uint16_t noodle_conv1d_planned(float *in_buffer,
+                                      uint16_t n_inputs,
+                                      uint16_t n_outputs,
+                                      uint16_t W,
+                                      uint16_t K,
+                                      uint16_t P,
+                                      uint16_t S,
+                                      Activation act,
+                                      const NoodleConvSrc &src,
+                                      const Pool *pool,
+                                      float *output,
+                                      uint16_t Vacc,
+                                      float *ws,
+                                      uint16_t R,
+                                      uint16_t B,
+                                      CBFPtr progress_cb,
+                                      float progress_step) {
+  const uint32_t per_out = (uint32_t)n_inputs * K;
+  const bool staged = (src.weight == NULL);
+  const uint16_t Vmax = (uint16_t)((W - K + 2 * P) / S + 1);
+
+  float *cache = ws;
+  float *acc = cache + (uint32_t)R * W;
+  float *stage = acc + (uint32_t)B * Vacc;
+  float *bias = stage + (staged ? (uint32_t)B * per_out : 0);
+
+  uint16_t V = 0;
+  uint16_t Vout = 0;
+  uint32_t stream_pos = 0;
+  float progress = 0.0f;
+
+  for (uint16_t O0 = 0; O0 < n_outputs; O0 = (uint16_t)(O0 + B)) {
+    const uint16_t nb = (n_outputs - O0 < B) ? (uint16_t)(n_outputs - O0) : B;
+    const float *wblock = noodle_conv_block_params(src, O0, nb, per_out, K, stage, bias);
+
+    for (uint32_t i = 0; i < (uint32_t)nb * Vacc; i++) acc[i] = 0.0f;
+
+    if (O0 == 0) noodle_rewind_file(fi);
+    else noodle_conv_seek_stream(R, stream_pos);
+
+    for (uint16_t I = 0; I < n_inputs; I++) {
+      float *in = in_buffer;
+      if (I < R) {
+        in = cache + (uint32_t)I * W;
+        if (O0 == 0) {
+          noodle_array_from_file(fi, in, W);
+          if (I + 1 == R) stream_pos = (uint32_t)fi.position();
+        }
+      } else {
+        noodle_array_from_file(fi, in, W);
+      }
+
+      for (uint16_t b = 0; b < nb; b++) {
+        const float *kernel = wblock + (uint32_t)b * per_out + (uint32_t)I * K;
+        V = noodle_do_conv1d(in, (float *)kernel, W, K, acc + b * Vacc, P, S);
+
+        if (progress_cb) progress_cb(progress);
+        progress += progress_step;
+      }
+    }
+
+    for (uint16_t b = 0; b < nb; b++) {
+      float *seq = acc + b * Vacc;
+      for (uint16_t i = 0; i < V; i++) {
+        float v = seq[i] + bias[b];
+        if ((act == ACT_RELU) && (v < 0.0f)) v = 0.0f;
+        seq[i] = v;
+      }
+
+      Vout = V;
+      if (pool) {
+        Vout = noodle_do_pooling1d(seq, V, pool->M, pool->T, fo);
+      } else if (output) {
+        float *out_seq = output + (uint32_t)(O0 + b) * Vmax;
+        for (uint16_t i = 0; i < V; i++) out_seq[i] = seq[i];
+      } else {
+        for (uint16_t i = 0; i < V; i++) noodle_out_float(fo, seq[i]);
+      }
+    }
+  }
+
+  return Vout;
+}
+
 // ===== Conv1D layer APIs =====
 
 uint16_t noodle_conv1d(const char *in_fn,
@@ -25,14 +345,31 @@ uint16_t noodle_conv1d(const char *in_fn,
   const uint16_t total = n_inputs * n_outputs;
   const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
 
-  fb = noodle_fs_open_read(conv.bias_fn);
-  fw = noodle_fs_open_read(conv.weight_fn);
+  fb = noodle_fs_open_cached(conv.bias_fn);
+  fw = noodle_fs_open_cached(conv.weight_fn);
   fi = noodle_fs_open_read(in_fn);      // packed input CHW
   fo = noodle_fs_open_write(out_fn);    // packed output CHW
 
   uint16_t V = 0;
   float kernel[NOODLE_MAX_K];
 
+  uint16_t R = 0, B = 1;
+  const uint16_t Vacc = noodle_conv1d_acc_len(W, conv.K, conv.P, conv.S);
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, W,
+                             (uint32_t)Vacc + (uint32_t)n_inputs * conv.K + 1,
+                             false, R, B);
+  if (ws) {
+    const NoodleConvSrc src = {NULL, NULL, false};
+    V = noodle_conv1d_planned(in_buffer, n_inputs, n_outputs, W, conv.K, conv.P,
+                              conv.S, conv.act, src, &pool, NULL, Vacc, ws, R, B,
+                              progress_cb, progress_step);
+    noodle_fs_release(fw, conv.weight_fn);
+    noodle_fs_release(fb, conv.bias_fn);
+    fi.close();
+    noodle_out_close(fo);
+    return V;
+  }
+
   for (uint16_t O = 0; O < n_outputs; O++) {
     noodle_reset_buffer(out_buffer, W);
     const float bias = noodle_read_float(fb);
@@ -65,10 +402,10 @@ uint16_t noodle_conv1d(const char *in_fn,
     V = noodle_do_pooling1d(out_buffer, V, pool.M, pool.T, fo);
   }
 
-  fw.close();
-  fb.close();
+  noodle_fs_release(fw, conv.weight_fn);
+  noodle_fs_release(fb, conv.bias_fn);
   fi.close();
-  fo.close();
+  noodle_out_close(fo);
   return V;
 }
 
@@ -86,14 +423,31 @@ uint16_t noodle_conv1d(const char *in_fn,
   const uint16_t total = n_inputs * n_outputs;
   const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
 
-  fb = noodle_fs_open_read(conv.bias_fn);
-  fw = noodle_fs_open_read(conv.weight_fn);
+  fb = noodle_fs_open_cached(conv.bias_fn);
+  fw = noodle_fs_open_cached(conv.weight_fn);
   fi = noodle_fs_open_read(in_fn);      // packed input CHW
   fo = noodle_fs_open_write(out_fn);    // packed output CHW
 
   uint16_t V = 0;
   float kernel[NOODLE_MAX_K];
 
+  uint16_t R = 0, B = 1;
+  const uint16_t Vacc = noodle_conv1d_acc_len(W, conv.K, conv.P, conv.S);
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, W,
+                             (uint32_t)Vacc + (uint32_t)n_inputs * conv.K + 1,
+                             false, R, B);
+  if (ws) {
+    const NoodleConvSrc src = {NULL, NULL, false};
+    V = noodle_conv1d_planned(in_buffer, n_inputs, n_outputs, W, conv.K, conv.P,
+                              conv.S, conv.act, src, NULL, NULL, Vacc, ws, R, B,
+                              progress_cb, progress_step);
+    noodle_fs_release(fw, conv.weight_fn);
+    noodle_fs_release(fb, conv.bias_fn);
+    fi.close();
+    noodle_out_close(fo);
+    return V;
+  }
+
   for (uint16_t O = 0; O < n_outputs; O++) {
     noodle_reset_buffer(out_buffer, W);
     const float bias = noodle_read_float(fb);
@@ -123,14 +477,14 @@ uint16_t noodle_conv1d(const char *in_fn,
 
     // No pooling: append raw V samples for this output channel.
     for (uint16_t i = 0; i < V; i++) {
-      noodle_write_float(fo, out_buffer[i]);
+      noodle_out_float(fo, out_buffer[i]);
     }
   }
 
-  fw.close();
-  fb.close();
+  noodle_fs_release(fw, conv.weight_fn);
+  noodle_fs_release(fb, conv.bias_fn);
   fi.close();
-  fo.close();
+  noodle_out_close(fo);
   return V;
 }
 
@@ -141,6 +495,7 @@ uint16_t noodle_conv1d(const char *in_fn,
                        uint16_t W,
                        const ConvMem &conv,
                        CBFPtr progress_cb) {
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K);
   float *in_buffer  = noodle_temp1_require((size_t)W);  // holds W floats
   float *out_buffer = noodle_temp2_require((size_t)W);  // holds one output channel
 
@@ -154,7 +509,30 @@ uint16_t noodle_conv1d(const char *in_fn,
   const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
 
   fi = noodle_fs_open_read(in_fn);
+
+  uint16_t R = 0, B = 1;
+  const uint16_t Vacc = noodle_conv1d_acc_len(W, conv.K, conv.P, conv.S);
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, W,
+                             (uint32_t)Vacc + 1,
+                             true, R, B);
+  if (ws && B == 0) {
+    // The whole input fits: load it once and run the RAM-input kernel, which
+    // opens the output itself.
+    noodle_conv_load_input(ws, n_inputs, W, false, W);
+    fi.close();
+    return noodle_conv1d(ws, n_inputs, out_fn, n_outputs, W, conv, progress_cb);
+  }
+
   fo = noodle_fs_open_write(out_fn);
+  if (ws) {
+    const NoodleConvSrc src = {conv.weight, conv.bias, false};
+    V = noodle_conv1d_planned(in_buffer, n_inputs, n_outputs, W, conv.K, conv.P,
+                              conv.S, conv.act, src, NULL, NULL, Vacc, ws, R, B,
+                              progress_cb, progress_step);
+    fi.close();
+    noodle_out_close(fo);
+    return V;
+  }
 
   for (uint16_t O = 0; O < n_outputs; O++) {
     //oodle_reset_buffer(out_buffer, Vmax);
@@ -183,15 +561,244 @@ uint16_t noodle_conv1d(const char *in_fn,
     }
 
     for (uint16_t i = 0; i < V; i++) {
-      noodle_write_float(fo, out_buffer[i]);
+      noodle_out_float(fo, out_buffer[i]);
     }
   }
 
   fi.close();
-  fo.close();
+  noodle_out_close(fo);
   return V;
 }
 
+// Output channels per GEMM block when the result must be pooled; one progress
+// step per block.
+#define NOODLE_GEMM_BLOCK 16
+
+// Scratch of the blocked and GEMM Conv1D kernels. It cannot be temp_buff2,
+// which may be a caller buffer of unknown size or the output itself, nor
+// temp_buff3, which holds the input on the budgeted file-input paths.
+static NoodleBuffer noodle_conv1d_ws = { NULL, 0 };
+
+void noodle_conv1d_scratch_free(void) {
+  noodle_buffer_free(&noodle_conv1d_ws);
+}
+
+// Bias, activation and pooling for one finished Conv1D channel. @p seq holds
+// V raw sums and is overwritten. Identity pooling (M = 1) copies to @p out or,
+// when it is NULL, appends to fo.
+static void noodle_conv1d_emit(float *seq, uint16_t V, float bias, Activation act,
+                               uint16_t M, uint16_t T, float *out) {
+  for (uint16_t i = 0; i < V; i++) {
+    float v = seq[i] + bias;
+    if ((act == ACT_RELU) && (v < 0.0f)) v = 0.0f;
+    seq[i] = v;
+  }
+  if (M > 1) noodle_do_pooling1d(seq, V, M, T, out);
+  else if (out) for (uint16_t i = 0; i < V; i++) out[i] = seq[i];
+  else for (uint16_t i = 0; i < V; i++) noodle_out_float(fo, seq[i]);
+}
+
+// Lower output samples x0..x0+n-1 of every input sequence into columns: row
+// (i, k) of @p cols holds the input under tap k of channel i for each of the
+// n outputs, zero where it falls in padding.
+static void noodle_im2col1d_band(const float *input, uint16_t n_inputs,
+                                 uint16_t W, uint16_t K, uint16_t P, uint16_t S,
+                                 uint16_t x0, uint16_t n, float *cols) {
+  float *dst = cols;
+  for (uint16_t i = 0; i < n_inputs; i++) {
+    const float *in = input + (uint32_t)i * W;
+    for (uint16_t k = 0; k < K; k++, dst += n) {
+      for (uint16_t x = 0; x < n; x++) {
+        const int32_t idx = (int32_t)(x0 + x) * S + k - P;
+        dst[x] = (idx < 0 || idx >= (int32_t)W) ? 0.0f : in[idx];
+      }
+    }
+  }
+}
+
+// Output samples per im2col band of noodle_conv1d_gemm().
+static uint32_t noodle_conv1d_gemm_band(uint32_t depth, uint16_t V) {
+  uint32_t n = (uint32_t)NOODLE_IM2COL_BUFFER / (depth * (uint32_t)sizeof(float));
+  if (n < 1) n = 1;
+  if (n > V) n = V;
+  return n;
+}
+
+// Conv1D as [O x I*K] . [I*K x n] over bands of n output samples, so the
+// column scratch stays within NOODLE_IM2COL_BUFFER. ConvMem weights are
+// already [O][I][K], i.e. row-major [O][I*K]. Unpooled RAM output is written
+// in place; otherwise blocks of NOODLE_GEMM_BLOCK channels go through scratch
+// first, all held in noodle_conv1d_ws.
+static uint16_t noodle_conv1d_gemm(const float *input,
+                                   uint16_t n_inputs,
+                                   uint16_t n_outputs,
+                                   float *output,
+                                   uint16_t W,
+                                   uint16_t V,
+                                   const ConvMem &conv,
+                                   uint16_t M,
+                                   uint16_t T,
+                                   CBFPtr progress_cb) {
+  const uint32_t depth = (uint32_t)n_inputs * conv.K;
+  const uint32_t n = noodle_conv1d_gemm_band(depth, V);
+
+  const bool direct = (output && M == 1);
+  const uint16_t block_o = direct ? n_outputs : (uint16_t)NOODLE_GEMM_BLOCK;
+  const uint16_t Wo = (M > 1) ? (uint16_t)((V - M) / T + 1) : V;
+
+  float *cols = noodle_buffer_require(&noodle_conv1d_ws,
+                                      (size_t)depth * n + (direct ? 0 : (size_t)block_o * V));
+  if (!cols) return 0;
+  float *block = cols + depth * n;
+
+  float progress = 0.0f;
+  const uint32_t total = (uint32_t)n_inputs * n_outputs;
+  const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+
+  for (uint16_t o = 0; o < n_outputs; o += block_o) {
+    const uint16_t ob = (n_outputs - o < block_o) ? (uint16_t)(n_outputs - o) : block_o;
+    float *dst = direct ? output + (uint32_t)o * V : block;
+
+    for (uint16_t x0 = 0; x0 < V; x0 += (uint16_t)n) {
+      const uint16_t r = ((uint32_t)(V - x0) < n) ? (uint16_t)(V - x0) : (uint16_t)n;
+      noodle_im2col1d_band(input, n_inputs, W, conv.K, conv.P, conv.S, x0, r, cols);
+      noodle_sgemm(ob, r, depth,
+                   conv.weight + (uint32_t)o * depth, depth,
+                   cols, r,
+                   dst + x0, V,
+                   direct && conv.bias ? conv.bias + o : nullptr,
+                   direct ? conv.act : ACT_NONE);
+    }
+
+    if (!direct) {
+      for (uint16_t b = 0; b < ob; b++)
+        noodle_conv1d_emit(block + (uint32_t)b * V, V, conv.bias ? conv.bias[o + b] : 0.0f,
+                           conv.act, M, T, output ? output + (uint32_t)(o + b) * Wo : NULL);
+    }
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step * (float)((uint32_t)ob * n_inputs);
+    }
+  }
+
+  return Wo;
+}
+
+#if NOODLE_CONV_OBLOCK > 1
+// Direct Conv1D in blocks of NOODLE_CONV_OBLOCK output channels: the block's
+// kernels are packed [I][K][B] once, then every input sequence is swept once
+// for all B accumulators. Scratch is noodle_conv1d_ws.
+static uint16_t noodle_conv1d_oblock(const float *input,
+                                     uint16_t n_inputs,
+                                     uint16_t n_outputs,
+                                     float *output,
+                                     uint16_t W,
+                                     uint16_t V,
+                                     const ConvMem &conv,
+                                     uint16_t M,
+                                     uint16_t T,
+                                     CBFPtr progress_cb) {
+  const uint8_t B = NOODLE_CONV_OBLOCK;
+  const uint32_t KB = (uint32_t)conv.K * B;
+  const uint32_t acc_len = (uint32_t)V * B;
+  float *acc = noodle_buffer_require(&noodle_conv1d_ws,
+                                     (size_t)acc_len + (size_t)n_inputs * KB + V);
+  if (!acc) return 0;
+  float *wp = acc + acc_len;
+  float *seq = wp + (uint32_t)n_inputs * KB;
+
+  const uint16_t Wo = (M > 1) ? (uint16_t)((V - M) / T + 1) : V;
+
+  float progress = 0.0f;
+  const uint32_t total = (uint32_t)n_inputs * n_outputs;
+  const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+
+  for (uint16_t o = 0; o < n_outputs; o += B) {
+    const uint16_t ob = (n_outputs - o < B) ? (uint16_t)(n_outputs - o) : (uint16_t)B;
+
+    // [I][K][B], zero weights for the missing channels of a tail block.
+    for (uint16_t i = 0; i < n_inputs; i++)
+      for (uint16_t k = 0; k < conv.K; k++)
+        for (uint8_t b = 0; b < B; b++)
+          wp[((uint32_t)i * conv.K + k) * B + b] =
+              (b < ob) ? conv.weight[((uint32_t)(o + b) * n_inputs + i) * conv.K + k] : 0.0f;
+
+    for (uint32_t p = 0; p < acc_len; p++) acc[p] = 0.0f;
+    for (uint16_t i = 0; i < n_inputs; i++)
+      noodle_do_conv1d_block(input + (uint32_t)i * W, wp + (uint32_t)i * KB,
+                             conv.K, W, acc, conv.P, conv.S);
+
+    for (uint16_t b = 0; b < ob; b++) {
+      for (uint16_t x = 0; x < V; x++) seq[x] = acc[(uint32_t)x * B + b];
+      noodle_conv1d_emit(seq, V, conv.bias ? conv.bias[o + b] : 0.0f, conv.act, M, T,
+                         output ? output + (uint32_t)(o + b) * Wo : NULL);
+    }
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step * (float)((uint32_t)ob * n_inputs);
+    }
+  }
+
+  return Wo;
+}
+#endif
+
+// Blocked RAM-input Conv1D with pooling window M and stride T (M = 1 for
+// none); @p output NULL appends to fo. CONV_ALGO_IM2COL, or AUTO for 1-tap
+// stride-1 layers, lowers to SGEMM; otherwise the output-channel blocked
+// kernel runs for layers with more than one output channel. Returns 0 when
+// neither applies so the caller keeps its per-channel loop.
+static uint16_t noodle_conv1d_mem(const float *input,
+                                  uint16_t n_inputs,
+                                  uint16_t n_outputs,
+                                  float *output,
+                                  uint16_t W,
+                                  const ConvMem &conv,
+                                  uint16_t M,
+                                  uint16_t T,
+                                  CBFPtr progress_cb) {
+  if (!input || !conv.weight || n_inputs == 0 || n_outputs == 0) return 0;
+  if (conv.S == 0 || (uint32_t)W + 2u * conv.P < conv.K) return 0;
+  const uint16_t V = (uint16_t)(((uint32_t)W + 2u * conv.P - conv.K) / conv.S + 1);
+  if (M > 1 && (T == 0 || V < M)) return 0;
+
+  if (conv.algo == CONV_ALGO_IM2COL ||
+      (conv.algo == CONV_ALGO_AUTO && conv.K == 1 && conv.S == 1 && conv.P == 0)) {
+    const uint16_t Vo = noodle_conv1d_gemm(input, n_inputs, n_outputs, output, W, V, conv, M, T, progress_cb);
+    if (Vo) return Vo;
+  }
+#if NOODLE_CONV_OBLOCK > 1
+  if (n_outputs > 1) {
+    const uint16_t Vo = noodle_conv1d_oblock(input, n_inputs, n_outputs, output, W, V, conv, M, T, progress_cb);
+    if (Vo) return Vo;
+  }
+#endif
+  return 0;
+}
+
+// Floats of noodle_conv1d_ws that noodle_conv1d_mem() takes for a layer with
+// V outputs per channel written unpooled to RAM; 0 when it would keep the
+// per-channel loop.
+static size_t noodle_conv1d_mem_scratch(uint16_t n_inputs,
+                                        uint16_t n_outputs,
+                                        uint16_t V,
+                                        const ConvMem &conv) {
+  if (conv.algo == CONV_ALGO_IM2COL ||
+      (conv.algo == CONV_ALGO_AUTO && conv.K == 1 && conv.S == 1 && conv.P == 0)) {
+    const uint32_t depth = (uint32_t)n_inputs * conv.K;
+    return (size_t)depth * noodle_conv1d_gemm_band(depth, V);
+  }
+#if NOODLE_CONV_OBLOCK > 1
+  if (n_outputs > 1) {
+    const uint32_t KB = (uint32_t)conv.K * NOODLE_CONV_OBLOCK;
+    return (size_t)V * NOODLE_CONV_OBLOCK + (size_t)n_inputs * KB + V;
+  }
+#else
+  (void)n_outputs;
+#endif
+  return 0;
+}
+
 uint16_t noodle_conv1d(float *in,
                        uint16_t n_inputs,
                        float *out,
@@ -199,6 +806,10 @@ uint16_t noodle_conv1d(float *in,
                        uint16_t W,
                        const ConvMem &conv,
                        CBFPtr progress_cb) {
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K);
+  const uint16_t Vb = noodle_conv1d_mem(in, n_inputs, n_outputs, out, W, conv, 1, 1, progress_cb);
+  if (Vb) return Vb;
+
   float *in_buffer = nullptr;
   float *out_buffer = nullptr;
 
@@ -247,15 +858,10 @@ uint16_t noodle_conv1d(float *in,
                        const ConvMem &conv,
                        const Pool &pool,
                        CBFPtr progress_cb) {
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K);
   if (!in || !out) return 0;
   if (!conv.weight) return 0;
 
-  const uint16_t Vmax = (uint16_t)((W - conv.K + 2 * conv.P) / conv.S + 1);
-
-  // temp_buff2 holds one output channel before pooling.
-  float *conv_buffer = noodle_temp2_require((size_t)Vmax);
-  if (!conv_buffer) return 0;
-
   uint16_t pool_M = pool.M;
   uint16_t pool_T = pool.T;
 
@@ -268,6 +874,15 @@ uint16_t noodle_conv1d(float *in,
     pool_T = pool_M;
   }
 
+  const uint16_t Vb = noodle_conv1d_mem(in, n_inputs, n_outputs, out, W, conv, pool_M, pool_T, progress_cb);
+  if (Vb) return Vb;
+
+  const uint16_t Vmax = (uint16_t)((W - conv.K + 2 * conv.P) / conv.S + 1);
+
+  // temp_buff2 holds one output channel before pooling.
+  float *conv_buffer = noodle_temp2_require((size_t)Vmax);
+  if (!conv_buffer) return 0;
+
   const uint16_t Wo = (pool_M <= 1) ? Vmax : (uint16_t)((Vmax - pool_M) / pool_T + 1);
 
   float progress = 0.0f;
@@ -329,23 +944,31 @@ uint16_t noodle_conv1d(float *in,
                        uint16_t W,
                        const ConvMem &conv,
                        CBFPtr progress_cb) {
-  float *out_buffer = noodle_temp2_require((size_t)W); // one accumulation buffer
-  if (!out_buffer) return 0;
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K);
+  fo = noodle_fs_open_write(out_fn);  // packed output CHW (append per output channel)
+  const uint16_t Vb = noodle_conv1d_mem(in, n_inputs, n_outputs, NULL, W, conv, 1, 1, progress_cb);
+  if (Vb) {
+    noodle_out_close(fo);
+    return Vb;
+  }
+
+  // One accumulation buffer; padding can make the output longer than W.
+  const uint16_t Vacc = noodle_conv1d_acc_len(W, conv.K, conv.P, conv.S);
+  float *out_buffer = noodle_temp2_require((size_t)Vacc);
+  if (!out_buffer) {
+    noodle_out_close(fo);
+    return 0;
+  }
 
   float progress = 0.0f;
   const uint16_t total = n_inputs * n_outputs;
   const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
 
-  // Output length per channel
-  //const uint16_t Vmax = (uint16_t)((W - conv.K + 2 * conv.P) / conv.S + 1);
   uint16_t V = 0;
 
-  fo = noodle_fs_open_write(out_fn);  // packed output CHW (append per output channel)
-
   for (uint16_t O = 0; O < n_outputs; O++) {
     // reset accumulation buffer for this output channel
-    //noodle_reset_buffer(out_buffer, Vmax);
-    noodle_reset_buffer(out_buffer, W);
+    noodle_reset_buffer(out_buffer, Vacc);
 
     const float bias = (conv.bias != nullptr) ? conv.bias[O] : 0.0f;
 
@@ -369,11 +992,11 @@ uint16_t noodle_conv1d(float *in,
 
     // Append raw V samples for this output channel
     for (uint16_t i = 0; i < V; i++) {
-      noodle_write_float(fo, out_buffer[i]);
+      noodle_out_float(fo, out_buffer[i]);
     }
   }
 
-  fo.close();
+  noodle_out_close(fo);
   return V;
 }
 
@@ -384,6 +1007,7 @@ uint16_t noodle_conv1d(const char *in_fn,
                        uint16_t W,
                        const ConvMem &conv,
                        CBFPtr progress_cb) {
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K);
   float *in_buffer = noodle_temp1_require((size_t)W);
 
   float progress = 0.0f;
@@ -396,6 +1020,26 @@ uint16_t noodle_conv1d(const char *in_fn,
 
   fi = noodle_fs_open_read(in_fn);   // packed input CHW
 
+  uint16_t R = 0, B = 1;
+  const uint16_t Vacc = noodle_conv1d_acc_len(W, conv.K, conv.P, conv.S);
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, W,
+                             (uint32_t)Vacc + 1,
+                             true, R, B);
+  if (ws && B == 0) {
+    // The whole input fits: load it once and run the RAM-input kernel.
+    noodle_conv_load_input(ws, n_inputs, W, false, W);
+    fi.close();
+    return noodle_conv1d(ws, n_inputs, out, n_outputs, W, conv, progress_cb);
+  }
+  if (ws) {
+    const NoodleConvSrc src = {conv.weight, conv.bias, false};
+    V = noodle_conv1d_planned(in_buffer, n_inputs, n_outputs, W, conv.K, conv.P,
+                              conv.S, conv.act, src, NULL, out, Vacc, ws, R, B,
+                              progress_cb, progress_step);
+    fi.close();
+    return V;
+  }
+
   for (uint16_t O = 0; O < n_outputs; O++) {
     float *out_buffer = out + (uint32_t)O * Vmax; // slicing
     //noodle_reset_buffer(out_buffer, Vmax);
@@ -440,6 +1084,106 @@ uint16_t noodle_conv1d(const char *in_fn,
 }
 
 
+// ===== Streaming Conv1D =====
+
+bool noodle_conv1d_stream_begin(NoodleConv1dStream &st,
+                                uint16_t n_inputs,
+                                uint16_t n_outputs,
+                                const ConvMem &conv,
+                                uint16_t max_n) {
+  noodle_conv1d_stream_end(st);
+  if (!conv.weight || conv.K == 0 || conv.S != 1 || conv.P >= conv.K) return false;
+  if (n_inputs == 0 || n_outputs == 0 || max_n == 0) return false;
+
+  const uint16_t H = (uint16_t)(conv.K - 1);
+  if (!noodle_buffer_require(&st.work, (size_t)n_inputs * (H + max_n))) return false;
+  if (H && !noodle_buffer_require(&st.hist, (size_t)n_inputs * H)) {
+    noodle_buffer_free(&st.work);
+    return false;
+  }
+
+  // Grow the shared Conv1D kernel scratch to a full push now. If this fails
+  // the pushes simply run the per-channel loop.
+  ConvMem valid = conv;
+  valid.P = 0;
+  const size_t ws = noodle_conv1d_mem_scratch(n_inputs, n_outputs, max_n, valid);
+  if (ws) noodle_buffer_require(&noodle_conv1d_ws, ws);
+
+  st.conv = &conv;
+  st.n_inputs = n_inputs;
+  st.n_outputs = n_outputs;
+  st.max_n = max_n;
+  noodle_conv1d_stream_reset(st);
+  return true;
+}
+
+void noodle_conv1d_stream_reset(NoodleConv1dStream &st) {
+  if (!st.conv) return;
+  const uint16_t H = (uint16_t)(st.conv->K - 1);
+  // Zero history stands in for the left padding of the whole-signal layer;
+  // the first K - 1 - P outputs read more of it than that padding and are
+  // dropped.
+  for (uint32_t i = 0; i < (uint32_t)st.n_inputs * H; i++) st.hist.data[i] = 0.0f;
+  st.skip = (uint16_t)(H - st.conv->P);
+}
+
+// Each push convolves, without padding, the window formed by the history and
+// the new samples, so every output is computed exactly once. Outputs still
+// held back are dropped by starting the window later instead of computing
+// and discarding them.
+uint16_t noodle_conv1d_stream_push(NoodleConv1dStream &st,
+                                   const float *in,
+                                   uint16_t n,
+                                   float *out,
+                                   CBFPtr progress_cb) {
+  if (!st.conv || !in || !out || n == 0 || n > st.max_n) return 0;
+
+  const uint16_t H = (uint16_t)(st.conv->K - 1);
+  const uint16_t d = (st.skip < n) ? st.skip : n;
+  const uint16_t Wn = (uint16_t)(H - d + n);
+
+  float *work = st.work.data;
+  for (uint16_t i = 0; i < st.n_inputs; i++) {
+    float *row = work + (uint32_t)i * Wn;
+    const float *hist = st.hist.data + (uint32_t)i * H;
+    const float *src = in + (uint32_t)i * n;
+    for (uint16_t t = d; t < H; t++) *row++ = hist[t];
+    for (uint16_t t = 0; t < n; t++) *row++ = src[t];
+  }
+
+  uint16_t m = 0;
+  if (Wn >= st.conv->K) {
+    ConvMem valid = *st.conv;
+    valid.P = 0;
+    m = noodle_conv1d(work, st.n_inputs, out, st.n_outputs, Wn, valid, progress_cb);
+  }
+
+  // Keep the last H samples of history followed by the new ones.
+  for (uint16_t i = 0; i < st.n_inputs; i++) {
+    float *hist = st.hist.data + (uint32_t)i * H;
+    const float *src = in + (uint32_t)i * n;
+    if (n >= H) {
+      for (uint16_t t = 0; t < H; t++) hist[t] = src[n - H + t];
+    } else {
+      for (uint16_t t = 0; t < H - n; t++) hist[t] = hist[t + n];
+      for (uint16_t t = 0; t < n; t++) hist[H - n + t] = src[t];
+    }
+  }
+
+  st.skip = (uint16_t)(st.skip - d);
+  return m;
+}
+
+void noodle_conv1d_stream_end(NoodleConv1dStream &st) {
+  noodle_buffer_free(&st.hist);
+  noodle_buffer_free(&st.work);
+  st.conv = nullptr;
+  st.n_inputs = 0;
+  st.n_outputs = 0;
+  st.max_n = 0;
+  st.skip = 0;
+}
+
 // ===== Conv2D layer APIs =====
 
 uint16_t noodle_conv_byte(const char *in_fn,
@@ -459,36 +1203,56 @@ uint16_t noodle_conv_byte(const char *in_fn,
   const uint16_t total = n_inputs * n_outputs;
   const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
 
-  fb = noodle_fs_open_read(conv.bias_fn);
-  fw = noodle_fs_open_read(conv.weight_fn);
+  fb = noodle_fs_open_cached(conv.bias_fn);
+  fw = noodle_fs_open_cached(conv.weight_fn);
   fi = noodle_fs_open_read(in_fn);      
   fo = noodle_fs_open_write(out_fn);      
 
   if (!fb || !fw || !fi || !fo) {
-    if (fb) fb.close();
-    if (fw) fw.close();
+    noodle_fs_release(fb, conv.bias_fn);
+    noodle_fs_release(fw, conv.weight_fn);
     if (fi) fi.close();
-    if (fo) fo.close();
+    if (fo) noodle_out_close(fo);
     return 0;
   }
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
-    fw.close(); fb.close(); fi.close(); fo.close();
+    noodle_fs_release(fw, conv.weight_fn); noodle_fs_release(fb, conv.bias_fn); fi.close(); noodle_out_close(fo);
     return 0;
   }
 
   uint16_t Vout = 0;
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K]; 
 
+  uint16_t R = 0, B = 1;
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, ((uint32_t)W * W + 3) / 4,
+                             (uint32_t)Vconv * Vconv + (uint32_t)n_inputs * conv.K * conv.K + 1,
+                             false, R, B);
+  if (ws) {
+    const NoodleConvSrc src = {NULL, NULL, false};
+    Vout = noodle_conv2d_planned(in_buffer, true, n_inputs, n_outputs, W, conv.K,
+                                 conv.P, conv.S, conv.act, src, pool, NULL, ws, R, B,
+                                 progress_cb, progress_step);
+    noodle_fs_release(fw, conv.weight_fn); noodle_fs_release(fb, conv.bias_fn); fi.close(); noodle_out_close(fo);
+    return Vout;
+  }
+
+  NoodleStream in_st, w_st;
+  noodle_stream_begin(&in_st, fi, (float *)in_buffer, (uint32_t)W * W,
+                      (uint32_t)n_inputs * W * W, n_outputs, true, NOODLE_PREFETCH_DEPTH);
+  noodle_stream_begin(&w_st, fw, (float *)kernel, (uint32_t)conv.K * conv.K,
+                      (uint32_t)n_inputs * conv.K * conv.K, n_outputs, false, n_inputs);
+  const uint32_t plane = (uint32_t)W * W;
   for (uint16_t O = 0; O < n_outputs; O++) {
     noodle_reset_buffer(out_buffer, Vconv * Vconv);
     const float bias = noodle_read_float(fb);
-    noodle_rewind_file(fi); // rewind input file for each output channel
     for (uint16_t I = 0; I < n_inputs; I++) {
-      noodle_grid_from_file(fi, in_buffer, W);
-      noodle_grid_from_file(fw, (float *)kernel, conv.K);
-      noodle_do_conv(in_buffer, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+      // Narrow the float plane to bytes; forward order is safe in place.
+      const float *src = noodle_stream_next(&in_st, NULL);
+      for (uint32_t i = 0; i < plane; i++) in_buffer[i] = src[i];
+      const float *k = noodle_stream_next(&w_st, NULL);
+      noodle_do_conv(in_buffer, k, conv.K, W, out_buffer, conv.P, conv.S);
       if (progress_cb) progress_cb(progress);
       progress += progress_step;
     }
@@ -497,10 +1261,12 @@ uint16_t noodle_conv_byte(const char *in_fn,
     Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
   }
 
-  fw.close(); 
-  fb.close(); 
+  noodle_stream_end(&w_st);
+  noodle_stream_end(&in_st);
+  noodle_fs_release(fw, conv.weight_fn); 
+  noodle_fs_release(fb, conv.bias_fn); 
   fi.close(); 
-  fo.close();
+  noodle_out_close(fo);
   return Vout;
 }
 
@@ -524,36 +1290,63 @@ uint16_t noodle_conv_float(const char *in_fn,
     progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
   }
 
-  fb = noodle_fs_open_read(conv.bias_fn);
-  fw = noodle_fs_open_read(conv.weight_fn);
   fi = noodle_fs_open_read(in_fn);
-  fo = noodle_fs_open_write(out_fn);
-
-  if (!fb || !fw || !fi || !fo) {
-    if (fb) fb.close();
-    if (fw) fw.close();
-    if (fi) fi.close();
-    if (fo) fo.close();
-    return 0;
-  }
+  if (!fi) return 0;
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
-    fw.close(); fb.close(); fi.close(); fo.close();
+    fi.close();
     return 0;
   }
 
   uint16_t Vout = 0;
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
+
+  // Plan before opening parameters and output: the all-resident case hands
+  // over to the RAM-input overload, which opens them itself.
+  uint16_t R = 0, B = 1;
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, (uint32_t)W * W,
+                             (uint32_t)Vconv * Vconv + (uint32_t)n_inputs * conv.K * conv.K + 1,
+                             true, R, B);
+  if (ws && B == 0) {
+    // The whole input fits: load it once and run the RAM-input kernel.
+    noodle_conv_load_input(ws, n_inputs, (uint32_t)W * W, true, W);
+    fi.close();
+    return noodle_conv_float(ws, n_inputs, n_outputs, out_fn, W, conv, pool, progress_cb);
+  }
+
+  fb = noodle_fs_open_cached(conv.bias_fn);
+  fw = noodle_fs_open_cached(conv.weight_fn);
+  fo = noodle_fs_open_write(out_fn);
+
+  if (!fb || !fw || !fo) {
+    noodle_fs_release(fb, conv.bias_fn);
+    noodle_fs_release(fw, conv.weight_fn);
+    fi.close();
+    if (fo) noodle_out_close(fo);
+    return 0;
+  }
+  if (ws) {
+    const NoodleConvSrc src = {NULL, NULL, false};
+    Vout = noodle_conv2d_planned(in_buffer, false, n_inputs, n_outputs, W, conv.K,
+                                 conv.P, conv.S, conv.act, src, pool, NULL, ws, R, B,
+                                 progress_cb, progress_step);
+    noodle_fs_release(fw, conv.weight_fn); noodle_fs_release(fb, conv.bias_fn); fi.close(); noodle_out_close(fo);
+    return Vout;
+  }
   
+  NoodleStream in_st, w_st;
+  noodle_stream_begin(&in_st, fi, in_buffer, (uint32_t)W * W,
+                      (uint32_t)n_inputs * W * W, n_outputs, true, NOODLE_PREFETCH_DEPTH);
+  noodle_stream_begin(&w_st, fw, (float *)kernel, (uint32_t)conv.K * conv.K,
+                      (uint32_t)n_inputs * conv.K * conv.K, n_outputs, false, n_inputs);
   for (uint16_t O = 0; O < n_outputs; O++) {
     noodle_reset_buffer(out_buffer, Vconv * Vconv);
     const float bias = noodle_read_float(fb);
-    noodle_rewind_file(fi); // rewind input file for each output channel
     for (uint16_t I = 0; I < n_inputs; I++) {
-      noodle_grid_from_file(fi, in_buffer, W);
-      noodle_grid_from_file(fw, (float *)kernel, conv.K);
-      noodle_do_conv(in_buffer, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+      float *in = noodle_stream_next(&in_st, NULL);
+      const float *k = noodle_stream_next(&w_st, NULL);
+      noodle_do_conv(in, k, conv.K, W, out_buffer, conv.P, conv.S);
       if (progress_cb){ 
         progress_cb(progress);
         progress += progress_step;
@@ -563,10 +1356,12 @@ uint16_t noodle_conv_float(const char *in_fn,
     noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
     Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
   }
-  fw.close();
-  fb.close();
+  noodle_stream_end(&w_st);
+  noodle_stream_end(&in_st);
+  noodle_fs_release(fw, conv.weight_fn);
+  noodle_fs_release(fb, conv.bias_fn);
   fi.close();
-  fo.close();
+  noodle_out_close(fo);
   return Vout;
 }
 
@@ -578,6 +1373,7 @@ uint16_t noodle_conv_float(const char *in_fn,
                            const ConvMem &conv,
                            const Pool &pool,
                            CBFPtr progress_cb) {
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K * conv.K);
   float *in_buffer  = noodle_temp1_require((size_t)W * W);
   float *out_buffer = noodle_temp2_require((size_t)W * W);
 
@@ -593,42 +1389,64 @@ uint16_t noodle_conv_float(const char *in_fn,
   }
 
   fi = noodle_fs_open_read(in_fn);
-  fo = noodle_fs_open_write(out_fn);
-
-  if (!fi || !fo) {
-    if (fi) fi.close();
-    if (fo) fo.close();
-    return 0;
-  }
+  if (!fi) return 0;
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
     fi.close();
-    fo.close();
     return 0;
   }
 
   uint16_t Vout = 0;
 
+  // Plan before opening the output: the all-resident case hands over to the
+  // RAM-input overload, which opens it itself.
+  uint16_t R = 0, B = 1;
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, (uint32_t)W * W,
+                             (uint32_t)Vconv * Vconv + 1,
+                             true, R, B);
+  if (ws && B == 0) {
+    // The whole input fits: load it once and run the RAM-input kernel.
+    noodle_conv_load_input(ws, n_inputs, (uint32_t)W * W, true, W);
+    fi.close();
+    return noodle_conv_float(ws, n_inputs, n_outputs, out_fn, W, conv, pool, progress_cb);
+  }
+
+  fo = noodle_fs_open_write(out_fn);
+  if (!fo) {
+    fi.close();
+    return 0;
+  }
+  if (ws) {
+    const NoodleConvSrc src = {conv.weight, conv.bias, false};
+    Vout = noodle_conv2d_planned(in_buffer, false, n_inputs, n_outputs, W, conv.K,
+                                 conv.P, conv.S, conv.act, src, pool, NULL, ws, R, B,
+                                 progress_cb, progress_step);
+    fi.close();
+    noodle_out_close(fo);
+    return Vout;
+  }
+
+  NoodleStream in_st;
+  noodle_stream_begin(&in_st, fi, in_buffer, (uint32_t)W * W,
+                      (uint32_t)n_inputs * W * W, n_outputs, true, NOODLE_PREFETCH_DEPTH);
+
   for (uint16_t O = 0; O < n_outputs; O++) {
     // temp_buff2 holds one accumulated pre-pooling output plane.
     noodle_reset_buffer(out_buffer, (uint32_t)Vconv * Vconv);
 
     const float bias = (conv.bias != nullptr) ? conv.bias[O] : 0.0f;
 
-    // Re-read all input channels for each output channel.
-    noodle_rewind_file(fi);
-
+    // The stream re-reads all input channels for each output channel.
     for (uint16_t I = 0; I < n_inputs; I++) {
-      // Read one input channel plane from file.
-      noodle_grid_from_file(fi, in_buffer, W);
+      float *in = noodle_stream_next(&in_st, NULL);
 
       // ConvMem weight layout:
       // [O][I][K][K]
       const float *kernel =
           conv.weight + (uint32_t)(O * n_inputs + I) * conv.K * conv.K;
 
-      noodle_do_conv(in_buffer,
+      noodle_do_conv(in,
                      kernel,
                      conv.K,
                      W,
@@ -648,8 +1466,9 @@ uint16_t noodle_conv_float(const char *in_fn,
     Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
   }
 
+  noodle_stream_end(&in_st);
   fi.close();
-  fo.close();
+  noodle_out_close(fo);
 
   return Vout;
 }
@@ -663,9 +1482,10 @@ uint16_t noodle_conv_float(const char *in_fn,
                            const Pool &pool,
                            CBFPtr progress_cb) {
   float *in_buffer  = noodle_temp1_require((size_t)W * W);
-  float *out_buffer = noodle_temp2_require((size_t)W * W);
+  const bool identity = noodle_pool_is_identity(pool);
+  float *out_buffer = identity ? nullptr : noodle_temp2_require((size_t)W * W);
 
-  if (!in_buffer || !out_buffer || !output) return 0;
+  if (!in_buffer || (!identity && !out_buffer) || !output) return 0;
 
   float progress = 0.0f;
   float progress_step = 0.0f;
@@ -674,54 +1494,82 @@ uint16_t noodle_conv_float(const char *in_fn,
     progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
   }
 
-  fb = noodle_fs_open_read(conv.bias_fn);
-  fw = noodle_fs_open_read(conv.weight_fn);
   fi = noodle_fs_open_read(in_fn);  // packed input
-
-  if (!fb || !fw || !fi) {
-    if (fb) fb.close();
-    if (fw) fw.close();
-    if (fi) fi.close();
-    return 0;
-  }
+  if (!fi) return 0;
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
-  if (Vconv == 0) {
-    fw.close();
-    fb.close();
+  if (Vconv == 0 || (!identity && (pool.T == 0 || Vconv < pool.M))) {
     fi.close();
     return 0;
   }
 
-  const uint16_t Wo = (uint16_t)((Vconv - pool.M) / pool.T + 1);
+  const uint16_t Wo = identity ? Vconv : (uint16_t)((Vconv - pool.M) / pool.T + 1);
   uint16_t Vout = 0;
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
 
+  // Plan before opening the parameters: the all-resident case hands over to
+  // the RAM-input overload, which opens them itself.
+  uint16_t R = 0, B = 1;
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, (uint32_t)W * W,
+                             (uint32_t)Vconv * Vconv + (uint32_t)n_inputs * conv.K * conv.K + 1,
+                             true, R, B);
+  if (ws && B == 0) {
+    // The whole input fits: load it once and run the RAM-input kernel.
+    noodle_conv_load_input(ws, n_inputs, (uint32_t)W * W, true, W);
+    fi.close();
+    return noodle_conv_float(ws, n_inputs, n_outputs, output, W, conv, pool, progress_cb);
+  }
+
+  fb = noodle_fs_open_cached(conv.bias_fn);
+  fw = noodle_fs_open_cached(conv.weight_fn);
+  if (!fb || !fw) {
+    noodle_fs_release(fb, conv.bias_fn);
+    noodle_fs_release(fw, conv.weight_fn);
+    fi.close();
+    return 0;
+  }
+  if (ws) {
+    const NoodleConvSrc src = {NULL, NULL, false};
+    Vout = noodle_conv2d_planned(in_buffer, false, n_inputs, n_outputs, W, conv.K,
+                                 conv.P, conv.S, conv.act, src, pool, output, ws, R, B,
+                                 progress_cb, progress_step);
+    noodle_fs_release(fw, conv.weight_fn);
+    noodle_fs_release(fb, conv.bias_fn);
+    fi.close();
+    return Vout;
+  }
+
+  NoodleStream in_st, w_st;
+  noodle_stream_begin(&in_st, fi, in_buffer, (uint32_t)W * W,
+                      (uint32_t)n_inputs * W * W, n_outputs, true, NOODLE_PREFETCH_DEPTH);
+  noodle_stream_begin(&w_st, fw, (float *)kernel, (uint32_t)conv.K * conv.K,
+                      (uint32_t)n_inputs * conv.K * conv.K, n_outputs, false, n_inputs);
   for (uint16_t O = 0; O < n_outputs; O++) {
-    // temp_buff2 holds one pre-pooling output plane.
-    noodle_reset_buffer(out_buffer, Vconv * Vconv);
+    // temp_buff2 holds the pre-pooling plane; identity pooling accumulates
+    // straight into the output plane.
+    float *out_plane = noodle_slice(output, Wo, O);
+    float *acc = identity ? out_plane : out_buffer;
+    for (uint32_t p = 0; p < (uint32_t)Vconv * Vconv; p++) acc[p] = 0.0f;
     const float bias = noodle_read_float(fb);
 
-    // rewind packed input for each output filter
-    noodle_rewind_file(fi);
-
+    // The input stream rewinds the packed input for each output filter.
     for (uint16_t I = 0; I < n_inputs; I++) {
-      noodle_grid_from_file(fi, in_buffer, W);
-      noodle_grid_from_file(fw, (float *)kernel, conv.K);
-      noodle_do_conv(in_buffer, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+      float *in = noodle_stream_next(&in_st, NULL);
+      const float *k = noodle_stream_next(&w_st, NULL);
+      noodle_do_conv(in, k, conv.K, W, acc, conv.P, conv.S);
       if (progress_cb) {
         progress_cb(progress);
         progress += progress_step;
       }
     }
 
-    noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
-    float *out_plane = noodle_slice(output, Wo, O);
-    Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, out_plane);
+    Vout = noodle_do_bias_act_pool(acc, bias, Vconv, conv.act, pool.M, pool.T, out_plane);
   }
 
-  fw.close(); 
-  fb.close(); 
+  noodle_stream_end(&w_st);
+  noodle_stream_end(&in_st);
+  noodle_fs_release(fw, conv.weight_fn); 
+  noodle_fs_release(fb, conv.bias_fn); 
   fi.close();
   return Vout;
 }
@@ -744,34 +1592,37 @@ uint16_t noodle_conv_float(float *input,
     progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
   }
 
-  fb = noodle_fs_open_read(conv.bias_fn);
-  fw = noodle_fs_open_read(conv.weight_fn);
+  fb = noodle_fs_open_cached(conv.bias_fn);
+  fw = noodle_fs_open_cached(conv.weight_fn);
   fo = noodle_fs_open_write(out_fn);   // packed output
 
   if (!fb || !fw || !fo) {
-    if (fb) fb.close();
-    if (fw) fw.close();
-    if (fo) fo.close();
+    noodle_fs_release(fb, conv.bias_fn);
+    noodle_fs_release(fw, conv.weight_fn);
+    if (fo) noodle_out_close(fo);
     return 0;
   }
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
-    fw.close(); fb.close(); fo.close();
+    noodle_fs_release(fw, conv.weight_fn); noodle_fs_release(fb, conv.bias_fn); noodle_out_close(fo);
     return 0;
   }
 
   uint16_t Vout = 0;
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
 
+  NoodleStream w_st;
+  noodle_stream_begin(&w_st, fw, (float *)kernel, (uint32_t)conv.K * conv.K,
+                      (uint32_t)n_inputs * conv.K * conv.K, n_outputs, false, n_inputs);
   for (uint16_t O = 0; O < n_outputs; O++) {
     noodle_reset_buffer(out_buffer, Vconv * Vconv);
     const float bias = noodle_read_float(fb);
 
     for (uint16_t I = 0; I < n_inputs; I++) {
       float *in_buffer = noodle_slice(input, W, I);
-      noodle_grid_from_file(fw, (float *)kernel, conv.K);
-      noodle_do_conv(in_buffer, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+      const float *k = noodle_stream_next(&w_st, NULL);
+      noodle_do_conv(in_buffer, k, conv.K, W, out_buffer, conv.P, conv.S);
 
       if (progress_cb) {
         progress_cb(progress);
@@ -783,9 +1634,10 @@ uint16_t noodle_conv_float(float *input,
     Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
   }
 
-  fw.close(); 
-  fb.close(); 
-  fo.close();
+  noodle_stream_end(&w_st);
+  noodle_fs_release(fw, conv.weight_fn); 
+  noodle_fs_release(fb, conv.bias_fn); 
+  noodle_out_close(fo);
   return Vout;
 }
 
@@ -798,6 +1650,7 @@ uint16_t noodle_conv_float(float *input,
                            const Pool &pool,
                            CBFPtr progress_cb)
 {
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K * conv.K);
   float *out_buffer = noodle_temp2_require((size_t)W * W);
   if (!input || !out_buffer || !conv.weight) return 0;
 
@@ -813,7 +1666,7 @@ uint16_t noodle_conv_float(float *input,
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
-    fo.close();
+    noodle_out_close(fo);
     return 0;
   }
 
@@ -838,7 +1691,7 @@ uint16_t noodle_conv_float(float *input,
     Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
   }
 
-  fo.close();
+  noodle_out_close(fo);
   return Vout;  // spatial size after pooling
 }
 
@@ -851,9 +1704,10 @@ uint16_t noodle_conv_float(float *input,
                            const Pool &pool,
                            CBFPtr progress_cb) {
   float *in_buffer = nullptr;
-  float *out_buffer = noodle_temp2_require((size_t)W * W);
+  const bool identity = noodle_pool_is_identity(pool);
+  float *out_buffer = identity ? nullptr : noodle_temp2_require((size_t)W * W);
 
-  if (!input || !output || !out_buffer) return 0;
+  if (!input || !output || (!identity && !out_buffer)) return 0;
 
   float progress = 0.0f;
   float progress_step = 0.0f;
@@ -862,62 +1716,571 @@ uint16_t noodle_conv_float(float *input,
     progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
   }
 
-  fb = noodle_fs_open_read(conv.bias_fn);
-  fw = noodle_fs_open_read(conv.weight_fn);
+  fb = noodle_fs_open_cached(conv.bias_fn);
+  fw = noodle_fs_open_cached(conv.weight_fn);
   if (!fb || !fw) {
-    if (fb) fb.close();
-    if (fw) fw.close();
+    noodle_fs_release(fb, conv.bias_fn);
+    noodle_fs_release(fw, conv.weight_fn);
     return 0;
   }
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
-  if (Vconv == 0) {
-    fw.close();
-    fb.close();
+  if (Vconv == 0 || (!identity && (pool.T == 0 || Vconv < pool.M))) {
+    noodle_fs_release(fw, conv.weight_fn);
+    noodle_fs_release(fb, conv.bias_fn);
     return 0;
   }
 
-  const uint16_t Wo = (uint16_t)((Vconv - pool.M) / pool.T + 1);
+  const uint16_t Wo = identity ? Vconv : (uint16_t)((Vconv - pool.M) / pool.T + 1);
   uint16_t Vout = 0;
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
 
+  NoodleStream w_st;
+  noodle_stream_begin(&w_st, fw, (float *)kernel, (uint32_t)conv.K * conv.K,
+                      (uint32_t)n_inputs * conv.K * conv.K, n_outputs, false, n_inputs);
   for (uint16_t O = 0; O < n_outputs; O++) {
-    // temp_buff2 holds one pre-pooling output plane.
-    noodle_reset_buffer(out_buffer, Vconv * Vconv);
+    // temp_buff2 holds the pre-pooling plane; identity pooling accumulates
+    // straight into the output plane.
+    float *out_plane = noodle_slice(output, Wo, O);
+    float *acc = identity ? out_plane : out_buffer;
+    for (uint32_t p = 0; p < (uint32_t)Vconv * Vconv; p++) acc[p] = 0.0f;
     const float bias = noodle_read_float(fb);
 
     for (uint16_t I = 0; I < n_inputs; I++) {
       in_buffer = noodle_slice(input, W, I);
-      noodle_grid_from_file(fw, (float *)kernel, conv.K);
-      noodle_do_conv(in_buffer, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+      const float *k = noodle_stream_next(&w_st, NULL);
+      noodle_do_conv(in_buffer, k, conv.K, W, acc, conv.P, conv.S);
       if (progress_cb) {
         progress_cb(progress);
         progress += progress_step;
       }
     }
 
-    noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
-    float *out_plane = noodle_slice(output, Wo, O);
-    Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, out_plane);
+    Vout = noodle_do_bias_act_pool(acc, bias, Vconv, conv.act, pool.M, pool.T, out_plane);
   }
 
-  fw.close();
-  fb.close();
+  noodle_stream_end(&w_st);
+  noodle_fs_release(fw, conv.weight_fn);
+  noodle_fs_release(fb, conv.bias_fn);
   return Vout;
 }
 
-uint16_t noodle_conv_float(float *input,
-                           uint16_t n_inputs,
-                           uint16_t n_outputs,
-                           float *output,
+// 1x1 stride-1 convolution as [O x I] . [I x W*W]. Without pooling the
+// result, bias and activation land directly in the output planes; with
+// pooling each block goes through temp_buff3 first. Returns 0 when the pool
+// does not fit the plane or the scratch block cannot be allocated so the
+// caller can use the direct path.
+static uint16_t noodle_conv_pointwise(const float *input,
+                                      uint16_t n_inputs,
+                                      uint16_t n_outputs,
+                                      float *output,
+                                      uint16_t W,
+                                      const ConvMem &conv,
+                                      const Pool &pool,
+                                      CBFPtr progress_cb) {
+  const uint32_t HW = (uint32_t)W * W;
+  const bool pooled = !noodle_pool_is_identity(pool);
+  const uint16_t M = pooled ? pool.M : 1;
+  const uint16_t T = pooled ? pool.T : 1;
+  if (T == 0 || W < M) return 0;
+  const uint16_t Wo = (uint16_t)((W - M) / T + 1);
+
+  float *block = nullptr;
+  if (pooled) {
+    block = noodle_temp3_require((size_t)NOODLE_GEMM_BLOCK * HW);
+    if (!block) return 0;
+  }
+
+  float progress = 0.0f;
+  const uint32_t total = (uint32_t)n_inputs * n_outputs;
+  const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+
+  uint16_t Vout = W;
+  for (uint16_t o = 0; o < n_outputs; o += NOODLE_GEMM_BLOCK) {
+    const uint16_t ob = (n_outputs - o < NOODLE_GEMM_BLOCK) ? (uint16_t)(n_outputs - o)
+                                                                  : (uint16_t)NOODLE_GEMM_BLOCK;
+    float *dst = pooled ? block : output + (uint32_t)o * HW;
+    noodle_sgemm(ob, HW, n_inputs,
+                 conv.weight + (uint32_t)o * n_inputs, n_inputs,
+                 input, HW,
+                 dst, HW,
+                 conv.bias ? conv.bias + o : nullptr, conv.act);
+
+    if (pooled) {
+      for (uint16_t b = 0; b < ob; b++)
+        Vout = noodle_do_pooling(block + (uint32_t)b * HW, W, M, T,
+                                 noodle_slice(output, Wo, (size_t)o + b));
+    }
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step * (float)((uint32_t)ob * n_inputs);
+    }
+  }
+
+  return Vout;
+}
+
+// Lower output rows y0..y0+rows-1 of every input plane into columns:
+// row (i, k, l) of @p cols holds the input value under tap (k, l) of channel
+// i for each of the rows * V output pixels, zero where it falls in padding.
+static void noodle_im2col_band(const float *input, uint16_t n_inputs,
+                               uint16_t W, uint16_t K, uint16_t S, uint16_t P0,
+                               uint16_t V, uint16_t y0, uint16_t rows,
+                               float *cols) {
+  const uint32_t plane = (uint32_t)W * W;
+  const uint32_t n = (uint32_t)rows * V;
+  float *dst = cols;
+
+  for (uint16_t i = 0; i < n_inputs; i++) {
+    const float *in = input + (uint32_t)i * plane;
+    for (uint16_t k = 0; k < K; k++) {
+      for (uint16_t l = 0; l < K; l++, dst += n) {
+        // Output columns whose tap l lands inside the row.
+        uint16_t xlo = (l < P0) ? (uint16_t)((P0 - l + S - 1) / S) : 0;
+        uint16_t xhi = 0;
+        if ((int32_t)W - 1 + P0 - l >= 0) {
+          const uint32_t last = (uint32_t)((int32_t)W - 1 + P0 - l) / S + 1;
+          xhi = (last > V) ? V : (uint16_t)last;
+        }
+        if (xlo > xhi) xlo = xhi;
+
+        for (uint16_t r = 0; r < rows; r++) {
+          float *d = dst + (uint32_t)r * V;
+          const int32_t iy = (int32_t)(y0 + r) * S - P0 + k;
+          if (iy < 0 || iy >= (int32_t)W) {
+            for (uint16_t x = 0; x < V; x++) d[x] = 0.0f;
+            continue;
+          }
+          const float *src = in + (uint32_t)iy * W;
+          const int32_t off = (int32_t)l - P0;
+          for (uint16_t x = 0; x < xlo; x++) d[x] = 0.0f;
+          for (uint16_t x = xlo; x < xhi; x++) d[x] = src[(int32_t)x * S + off];
+          for (uint16_t x = xhi; x < V; x++) d[x] = 0.0f;
+        }
+      }
+    }
+  }
+}
+
+// Conv2D as [O x I*K*K] . [I*K*K x rows*V] over bands of output rows, so the
+// column scratch stays within NOODLE_IM2COL_BUFFER. ConvMem weights are
+// already [O][I][K][K], i.e. row-major [O][I*K*K]. Returns 0 when the pool
+// does not fit the plane or scratch cannot be allocated so the caller can use
+// the direct path.
+static uint16_t noodle_conv_im2col(const float *input,
+                                   uint16_t n_inputs,
+                                   uint16_t n_outputs,
+                                   float *output,
+                                   uint16_t W,
+                                   const ConvMem &conv,
+                                   const Pool &pool,
+                                   CBFPtr progress_cb) {
+  uint16_t P0, P1;
+  const uint16_t V = noodle_compute_V_and_P(conv.K, W, conv.P, conv.S, P0, P1);
+  if (V == 0) return 0;
+
+  const uint32_t VV = (uint32_t)V * V;
+  const uint32_t depth = (uint32_t)n_inputs * conv.K * conv.K;
+  uint32_t rows = (uint32_t)NOODLE_IM2COL_BUFFER / (depth * V * (uint32_t)sizeof(float));
+  if (rows < 1) rows = 1;
+  if (rows > V) rows = V;
+
+  const bool pooled = !noodle_pool_is_identity(pool);
+  const uint16_t M = pooled ? pool.M : 1;
+  const uint16_t T = pooled ? pool.T : 1;
+  if (T == 0 || V < M) return 0;
+  const uint16_t block_o = pooled ? (uint16_t)NOODLE_GEMM_BLOCK : n_outputs;
+  const uint16_t Wo = (uint16_t)((V - M) / T + 1);
+
+  float *cols = noodle_temp3_require((size_t)depth * rows * V + (pooled ? (size_t)block_o * VV : 0));
+  if (!cols) return 0;
+  float *block = cols + depth * rows * V;
+
+  float progress = 0.0f;
+  const uint32_t total = (uint32_t)n_inputs * n_outputs;
+  const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+
+  uint16_t Vout = V;
+  for (uint16_t o = 0; o < n_outputs; o += block_o) {
+    const uint16_t ob = (n_outputs - o < block_o) ? (uint16_t)(n_outputs - o) : block_o;
+    float *dst = pooled ? block : output + (uint32_t)o * VV;
+
+    for (uint16_t y0 = 0; y0 < V; y0 += (uint16_t)rows) {
+      const uint16_t r = ((uint32_t)(V - y0) < rows) ? (uint16_t)(V - y0) : (uint16_t)rows;
+      noodle_im2col_band(input, n_inputs, W, conv.K, conv.S, P0, V, y0, r, cols);
+      noodle_sgemm(ob, (uint32_t)r * V, depth,
+                   conv.weight + (uint32_t)o * depth, depth,
+                   cols, (uint32_t)r * V,
+                   dst + (uint32_t)y0 * V, VV,
+                   conv.bias ? conv.bias + o : nullptr, conv.act);
+    }
+
+    if (pooled) {
+      for (uint16_t b = 0; b < ob; b++)
+        Vout = noodle_do_pooling(block + (uint32_t)b * VV, V, M, T,
+                                 noodle_slice(output, Wo, (size_t)o + b));
+    }
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step * (float)((uint32_t)ob * n_inputs);
+    }
+  }
+
+  return Vout;
+}
+
+// ===== Winograd F(2x2,3x3) =====
+// Each 2x2 output tile comes from a 4x4 input tile d as A^T [U . (B^T d B)] A,
+// where U = G g G^T. Per transformed coefficient xi the products summed over
+// input channels form one [O x I] . [I x tiles] SGEMM.
+
+void noodle_winograd_weights(const float *weight, uint16_t n_inputs,
+                             uint16_t n_outputs, float *out) {
+  const uint32_t OI = (uint32_t)n_outputs * n_inputs;
+  for (uint32_t oi = 0; oi < OI; oi++) {
+    const float *g = weight + oi * 9;
+    float t[4][3];  // G g
+    for (uint8_t c = 0; c < 3; c++) {
+      t[0][c] = g[c];
+      t[1][c] = 0.5f * (g[c] + g[3 + c] + g[6 + c]);
+      t[2][c] = 0.5f * (g[c] - g[3 + c] + g[6 + c]);
+      t[3][c] = g[6 + c];
+    }
+    for (uint8_t r = 0; r < 4; r++) {  // (G g) G^T
+      float *u = out + (uint32_t)(r * 4) * OI + oi;
+      u[0]      = t[r][0];
+      u[OI]     = 0.5f * (t[r][0] + t[r][1] + t[r][2]);
+      u[2 * OI] = 0.5f * (t[r][0] - t[r][1] + t[r][2]);
+      u[3 * OI] = t[r][2];
+    }
+  }
+}
+
+#if NOODLE_WINOGRAD_CACHE > 0
+struct NoodleWinogradSlot {
+  const float *weight;
+  uint16_t I, O;
+  float *U;
+};
+static NoodleWinogradSlot noodle_wino_cache[NOODLE_WINOGRAD_CACHE];
+static uint8_t noodle_wino_next = 0;
+#endif
+
+void noodle_winograd_clear(void) {
+#if NOODLE_WINOGRAD_CACHE > 0
+  for (uint8_t s = 0; s < NOODLE_WINOGRAD_CACHE; s++) {
+    free(noodle_wino_cache[s].U);
+    noodle_wino_cache[s] = NoodleWinogradSlot();
+  }
+  noodle_wino_next = 0;
+#endif
+}
+
+// Transformed weights for @p conv: the caller's precomputed array, a cache
+// hit, or a fresh cache entry. nullptr means the caller transforms into
+// scratch itself (cache disabled or out of heap).
+static const float *noodle_winograd_lookup(const ConvMem &conv,
+                                           uint16_t n_inputs, uint16_t n_outputs) {
+  if (conv.winograd) return conv.winograd;
+#if NOODLE_WINOGRAD_CACHE > 0
+  for (uint8_t s = 0; s < NOODLE_WINOGRAD_CACHE; s++) {
+    const NoodleWinogradSlot &e = noodle_wino_cache[s];
+    if (e.U && e.weight == conv.weight && e.I == n_inputs && e.O == n_outputs) return e.U;
+  }
+  float *U = noodle_alloc_temp_float((size_t)16 * n_outputs * n_inputs);
+  if (!U) return nullptr;
+  noodle_winograd_weights(conv.weight, n_inputs, n_outputs, U);
+
+  NoodleWinogradSlot &e = noodle_wino_cache[noodle_wino_next];
+  free(e.U);
+  e.weight = conv.weight;
+  e.I = n_inputs;
+  e.O = n_outputs;
+  e.U = U;
+  noodle_wino_next = (uint8_t)((noodle_wino_next + 1) % NOODLE_WINOGRAD_CACHE);
+  return U;
+#else
+  return nullptr;
+#endif
+}
+
+// B^T d B for tile rows ty0..ty0+tr-1 of every input plane. Coefficient xi of
+// channel i, tile t lands at vt[(xi * I + i) * nt + t].
+static void noodle_winograd_input(const float *input, uint16_t n_inputs,
+                                  uint16_t W, uint16_t P0, uint16_t TW,
+                                  uint16_t ty0, uint16_t tr, float *vt) {
+  const uint32_t nt = (uint32_t)tr * TW;
+  const uint32_t step = (uint32_t)n_inputs * nt;
+
+  for (uint16_t i = 0; i < n_inputs; i++) {
+    const float *in = input + (uint32_t)i * W * W;
+    float *v = vt + (uint32_t)i * nt;
+
+    for (uint16_t r = 0; r < tr; r++) {
+      const int32_t y = (int32_t)(ty0 + r) * 2 - P0;
+      for (uint16_t tx = 0; tx < TW; tx++) {
+        const int32_t x = (int32_t)tx * 2 - P0;
+        float d[4][4];
+        if (y >= 0 && y + 3 < (int32_t)W && x >= 0 && x + 3 < (int32_t)W) {
+          const float *src = in + (uint32_t)y * W + x;
+          for (uint8_t a = 0; a < 4; a++, src += W)
+            for (uint8_t b = 0; b < 4; b++) d[a][b] = src[b];
+        } else {
+          for (uint8_t a = 0; a < 4; a++) {
+            const int32_t iy = y + a;
+            for (uint8_t b = 0; b < 4; b++) {
+              const int32_t ix = x + b;
+              d[a][b] = (iy >= 0 && iy < (int32_t)W && ix >= 0 && ix < (int32_t)W)
+                          ? in[(uint32_t)iy * W + ix] : 0.0f;
+            }
+          }
+        }
+
+        float t[4][4];  // B^T d
+        for (uint8_t b = 0; b < 4; b++) {
+          t[0][b] = d[0][b] - d[2][b];
+          t[1][b] = d[1][b] + d[2][b];
+          t[2][b] = d[2][b] - d[1][b];
+          t[3][b] = d[1][b] - d[3][b];
+        }
+        float *o = v + (uint32_t)r * TW + tx;
+        for (uint8_t a = 0; a < 4; a++, o += 4 * step) {  // (B^T d) B
+          o[0]        = t[a][0] - t[a][2];
+          o[step]     = t[a][1] + t[a][2];
+          o[2 * step] = t[a][2] - t[a][1];
+          o[3 * step] = t[a][1] - t[a][3];
+        }
+      }
+    }
+  }
+}
+
+// A^T m A for @p ob channels, plus bias and activation, clipped to V x V.
+static void noodle_winograd_output(const float *mt, uint16_t ob, uint16_t TW,
+                                   uint16_t ty0, uint16_t tr, uint16_t V,
+                                   const float *bias, Activation act, float *dst) {
+  const uint32_t nt = (uint32_t)tr * TW;
+  const uint32_t step = (uint32_t)ob * nt;
+  const uint32_t VV = (uint32_t)V * V;
+
+  for (uint16_t b = 0; b < ob; b++) {
+    const float bv = bias ? bias[b] : 0.0f;
+    float *plane = dst + (uint32_t)b * VV;
+    for (uint16_t r = 0; r < tr; r++) {
+      const uint16_t y = (uint16_t)((ty0 + r) * 2);
+      for (uint16_t tx = 0; tx < TW; tx++) {
+        const float *m = mt + (uint32_t)b * nt + (uint32_t)r * TW + tx;
+        float t[2][4];  // A^T m
+        for (uint8_t c = 0; c < 4; c++) {
+          const float m0 = m[(uint32_t)c * step];
+          const float m1 = m[(uint32_t)(4 + c) * step];
+          const float m2 = m[(uint32_t)(8 + c) * step];
+          const float m3 = m[(uint32_t)(12 + c) * step];
+          t[0][c] = m0 + m1 + m2;
+          t[1][c] = m1 - m2 - m3;
+        }
+        const uint16_t x = (uint16_t)(tx * 2);
+        for (uint8_t a = 0; a < 2 && y + a < V; a++) {  // (A^T m) A
+          float px[2] = {t[a][0] + t[a][1] + t[a][2] + bv,
+                         t[a][1] - t[a][2] - t[a][3] + bv};
+          float *row = plane + (uint32_t)(y + a) * V + x;
+          for (uint8_t c = 0; c < 2 && x + c < V; c++)
+            row[c] = (act == ACT_RELU && px[c] < 0.0f) ? 0.0f : px[c];
+        }
+      }
+    }
+  }
+}
+
+// 3x3 stride-1 convolution with Winograd F(2x2,3x3) over bands of tile rows
+// sized by NOODLE_WINOGRAD_BUFFER. Channel blocking and pooling follow the
+// im2col path. Returns 0 when the pool does not fit the plane or scratch
+// cannot be allocated.
+static uint16_t noodle_conv_winograd(const float *input,
+                                     uint16_t n_inputs,
+                                     uint16_t n_outputs,
+                                     float *output,
+                                     uint16_t W,
+                                     const ConvMem &conv,
+                                     const Pool &pool,
+                                     CBFPtr progress_cb) {
+  uint16_t P0, P1;
+  const uint16_t V = noodle_compute_V_and_P(3, W, conv.P, 1, P0, P1);
+  if (V == 0) return 0;
+
+  const uint32_t VV = (uint32_t)V * V;
+  const uint16_t TW = (uint16_t)((V + 1) / 2);
+  const bool pooled = !noodle_pool_is_identity(pool);
+  const uint16_t M = pooled ? pool.M : 1;
+  const uint16_t T = pooled ? pool.T : 1;
+  if (T == 0 || V < M) return 0;
+  const uint16_t block_o = pooled ? (uint16_t)NOODLE_GEMM_BLOCK : n_outputs;
+  const uint16_t Wo = (uint16_t)((V - M) / T + 1);
+
+  const uint32_t row_floats = (uint32_t)16 * TW * (n_inputs + block_o);
+  uint32_t trows = (uint32_t)NOODLE_WINOGRAD_BUFFER / (row_floats * (uint32_t)sizeof(float));
+  if (trows < 1) trows = 1;
+  if (trows > TW) trows = TW;
+  const uint32_t nt_max = trows * TW;
+
+  const float *U = noodle_winograd_lookup(conv, n_inputs, n_outputs);
+  const size_t u_floats = U ? 0 : (size_t)16 * n_outputs * n_inputs;
+  float *scratch = noodle_temp3_require(u_floats + (size_t)16 * nt_max * (n_inputs + block_o) +
+                                        (pooled ? (size_t)block_o * VV : 0));
+  if (!scratch) return 0;
+  if (!U) {
+    noodle_winograd_weights(conv.weight, n_inputs, n_outputs, scratch);
+    U = scratch;
+  }
+  float *vt = scratch + u_floats;
+  float *mt = vt + (size_t)16 * nt_max * n_inputs;
+  float *block = mt + (size_t)16 * nt_max * block_o;
+  const uint32_t OI = (uint32_t)n_outputs * n_inputs;
+
+  float progress = 0.0f;
+  const uint32_t total = (uint32_t)n_inputs * n_outputs;
+  const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+
+  uint16_t Vout = V;
+  for (uint16_t o = 0; o < n_outputs; o += block_o) {
+    const uint16_t ob = (n_outputs - o < block_o) ? (uint16_t)(n_outputs - o) : block_o;
+    float *dst = pooled ? block : output + (uint32_t)o * VV;
+
+    for (uint16_t ty0 = 0; ty0 < TW; ty0 += (uint16_t)trows) {
+      const uint16_t tr = ((uint32_t)(TW - ty0) < trows) ? (uint16_t)(TW - ty0) : (uint16_t)trows;
+      const uint32_t nt = (uint32_t)tr * TW;
+      noodle_winograd_input(input, n_inputs, W, P0, TW, ty0, tr, vt);
+      for (uint8_t xi = 0; xi < 16; xi++)
+        noodle_sgemm(ob, nt, n_inputs,
+                     U + xi * OI + (uint32_t)o * n_inputs, n_inputs,
+                     vt + (uint32_t)xi * n_inputs * nt, nt,
+                     mt + (uint32_t)xi * ob * nt, nt,
+                     nullptr, ACT_NONE);
+      noodle_winograd_output(mt, ob, TW, ty0, tr, V,
+                             conv.bias ? conv.bias + o : nullptr, conv.act,
+                             dst);
+    }
+
+    if (pooled) {
+      for (uint16_t b = 0; b < ob; b++)
+        Vout = noodle_do_pooling(block + (uint32_t)b * VV, V, M, T,
+                                 noodle_slice(output, Wo, (size_t)o + b));
+    }
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step * (float)((uint32_t)ob * n_inputs);
+    }
+  }
+
+  return Vout;
+}
+
+// ===== Output-channel blocked direct convolution =====
+
+#if NOODLE_CONV_OBLOCK > 1
+// Direct convolution in blocks of NOODLE_CONV_OBLOCK output channels: the
+// block's kernels are packed [I][K][K][B] once, then every input plane is
+// swept once for all B accumulators. Without pooling, or with a pool stride
+// of at least the window, only the rows one pooled output row needs are
+// accumulated at a time; overlapping windows keep the whole plane. Returns 0
+// when the accumulators cannot be allocated so the caller can fall back to
+// the per-channel loop.
+static uint16_t noodle_conv_oblock(const float *input,
+                                   uint16_t n_inputs,
+                                   uint16_t n_outputs,
+                                   float *output,
+                                   uint16_t W,
+                                   const ConvMem &conv,
+                                   const Pool &pool,
+                                   CBFPtr progress_cb) {
+  const uint8_t B = NOODLE_CONV_OBLOCK;
+  const uint16_t V = noodle_compute_V(conv.K, W, conv.P, conv.S);
+  if (V == 0) return 0;
+
+  const bool identity = noodle_pool_is_identity(pool);
+  const uint16_t M = identity ? 1 : pool.M;
+  const uint16_t T = identity ? 1 : pool.T;
+  if (T == 0 || V < M) return 0;
+  const bool banded = (T >= M);
+  const uint16_t Wo = (uint16_t)((V - M) / T + 1);
+  const uint16_t band = banded ? M : V;
+
+  const uint32_t KK = (uint32_t)conv.K * conv.K;
+  const uint32_t band_len = (uint32_t)band * V * B;
+  float *acc = noodle_temp3_require((size_t)band_len + (size_t)n_inputs * KK * B);
+  if (!acc) return 0;
+  float *wp = acc + band_len;
+
+  float progress = 0.0f;
+  const uint32_t total = (uint32_t)n_inputs * n_outputs;
+  const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+
+  for (uint16_t o = 0; o < n_outputs; o += B) {
+    const uint16_t ob = (n_outputs - o < B) ? (uint16_t)(n_outputs - o) : (uint16_t)B;
+
+    // [I][K][K][B], zero weights for the missing channels of a tail block.
+    for (uint16_t i = 0; i < n_inputs; i++)
+      for (uint32_t t = 0; t < KK; t++)
+        for (uint8_t b = 0; b < B; b++)
+          wp[((uint32_t)i * KK + t) * B + b] =
+              (b < ob) ? conv.weight[((uint32_t)(o + b) * n_inputs + i) * KK + t] : 0.0f;
+
+    for (uint16_t y = 0; y < Wo;) {
+      const uint16_t r0 = banded ? (uint16_t)(y * T) : 0;
+      for (uint32_t p = 0; p < band_len; p++) acc[p] = 0.0f;
+      for (uint16_t i = 0; i < n_inputs; i++)
+        noodle_do_conv_block_rows(input + (uint32_t)i * W * W, wp + (uint32_t)i * KK * B,
+                                  conv.K, W, acc, conv.P, conv.S, r0, (uint16_t)(r0 + band));
+
+      const uint16_t y1 = banded ? (uint16_t)(y + 1) : Wo;
+      for (; y < y1; y++) {
+        const float *rows = acc + (uint32_t)(y * T - r0) * V * B;
+        for (uint16_t b = 0; b < ob; b++)
+          noodle_pool_bias_act_row(rows + b, V, B, M, T, conv.bias ? conv.bias[o + b] : 0.0f,
+                                   conv.act, noodle_slice(output, Wo, (size_t)o + b) + (uint32_t)y * Wo);
+      }
+    }
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step * (float)((uint32_t)ob * n_inputs);
+    }
+  }
+
+  return Wo;
+}
+#endif
+
+uint16_t noodle_conv_float(float *input,
+                           uint16_t n_inputs,
+                           uint16_t n_outputs,
+                           float *output,
                            uint16_t W,
                            const ConvMem &conv,
                            const Pool &pool,
                            CBFPtr progress_cb) {
-  float *in_buffer = nullptr;
-  float *out_buffer = noodle_temp2_require((size_t)W * W);
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K * conv.K);
+  if (!input || !output || !conv.weight) return 0;
 
-  if (!input || !output || !out_buffer || !conv.weight) return 0;
+  if (conv.algo != CONV_ALGO_DIRECT && conv.K == 1 && conv.S == 1 &&
+      (conv.P == 0 || conv.P == 65535)) {
+    const uint16_t V = noodle_conv_pointwise(input, n_inputs, n_outputs, output, W, conv, pool, progress_cb);
+    if (V) return V;
+  }
+  if ((conv.algo == CONV_ALGO_WINOGRAD || (conv.algo == CONV_ALGO_AUTO && conv.winograd)) &&
+      conv.K == 3 && conv.S == 1) {
+    const uint16_t V = noodle_conv_winograd(input, n_inputs, n_outputs, output, W, conv, pool, progress_cb);
+    if (V) return V;
+  }
+  if (conv.algo == CONV_ALGO_IM2COL) {
+    const uint16_t V = noodle_conv_im2col(input, n_inputs, n_outputs, output, W, conv, pool, progress_cb);
+    if (V) return V;
+  }
+#if NOODLE_CONV_OBLOCK > 1
+  {
+    const uint16_t V = noodle_conv_oblock(input, n_inputs, n_outputs, output, W, conv, pool, progress_cb);
+    if (V) return V;
+  }
+#endif
 
   float progress = 0.0f;
   float progress_step = 0.0f;
@@ -929,30 +2292,59 @@ uint16_t noodle_conv_float(float *input,
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) return 0;
 
-  const uint16_t Wo = (uint16_t)((Vconv - pool.M) / pool.T + 1);
-  uint16_t Vout = 0;
+  const bool identity = noodle_pool_is_identity(pool);
+  const uint16_t M = identity ? 1 : pool.M;
+  const uint16_t T = identity ? 1 : pool.T;
+  if (T == 0 || Vconv < M) return 0;
+  const uint16_t Wo = (uint16_t)((Vconv - M) / T + 1);
+
+  // Identity pooling accumulates straight into the output plane. Strided
+  // pooling keeps the M rows of one pooled output row in temp_buff2;
+  // overlapping windows keep the whole plane there.
+  const bool banded = !identity && T >= M;
+  float *out_buffer = nullptr;
+  if (!identity) {
+    out_buffer = noodle_temp2_require((size_t)(banded ? M : Vconv) * Vconv);
+    if (!out_buffer) return 0;
+  }
 
   for (uint16_t O = 0; O < n_outputs; O++) {
-    // temp_buff2 holds one pre-pooling output plane.
-    noodle_reset_buffer(out_buffer, Vconv * Vconv);
     const float bias = (conv.bias != nullptr) ? conv.bias[O] : 0.0f;
+    const float *kernels = conv.weight + (uint32_t)O * n_inputs * conv.K * conv.K;
+    float *out_plane = noodle_slice(output, Wo, O);
 
+    if (banded) {
+      const uint32_t band = (uint32_t)M * Vconv;
+      for (uint16_t y = 0; y < Wo; y++) {
+        const uint16_t r0 = (uint16_t)(y * T);
+        for (uint32_t p = 0; p < band; p++) out_buffer[p] = 0.0f;
+        for (uint16_t I = 0; I < n_inputs; I++)
+          noodle_do_conv_rows(noodle_slice(input, W, I), kernels + (uint32_t)I * conv.K * conv.K,
+                              conv.K, W, out_buffer, conv.P, conv.S, r0, (uint16_t)(r0 + M));
+        noodle_pool_bias_act_row(out_buffer, Vconv, 1, M, T, bias, conv.act,
+                                 out_plane + (uint32_t)y * Wo);
+      }
+      if (progress_cb) {
+        progress_cb(progress);
+        progress += progress_step * (float)n_inputs;
+      }
+      continue;
+    }
+
+    float *acc = identity ? out_plane : out_buffer;
+    for (uint32_t p = 0; p < (uint32_t)Vconv * Vconv; p++) acc[p] = 0.0f;
     for (uint16_t I = 0; I < n_inputs; I++) {
-      const float *kernel = conv.weight + (uint32_t)(O * n_inputs + I) * conv.K * conv.K;
-      in_buffer = noodle_slice(input, W, I);
-      noodle_do_conv(in_buffer, kernel, conv.K, W, out_buffer, conv.P, conv.S);
+      noodle_do_conv(noodle_slice(input, W, I), kernels + (uint32_t)I * conv.K * conv.K,
+                     conv.K, W, acc, conv.P, conv.S);
       if (progress_cb) {
         progress_cb(progress);
         progress += progress_step;
       }
     }
-
-    noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
-    float *out_plane = noodle_slice(output, Wo, O);
-    Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, out_plane);
+    noodle_do_bias_act_pool(acc, bias, Vconv, conv.act, M, T, out_plane);
   }
 
-  return Vout;
+  return Wo;
 }
 
 
@@ -965,7 +2357,8 @@ uint16_t noodle_conv_transpose_float(float *input,
                                      uint16_t W,
                                      const ConvMem &conv,
                                      CBFPtr progress_cb) {
-  if (!input || !output || !conv.weight) return 0;
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K * conv.K);
+  if (!input || !output || !conv.weight || n_inputs == 0) return 0;
 
   uint16_t P0, P1;
   const uint16_t Vt = noodle_compute_Vt_and_P(
@@ -984,22 +2377,17 @@ uint16_t noodle_conv_transpose_float(float *input,
   const uint32_t total = (uint32_t)n_inputs * (uint32_t)n_outputs;
   const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
 
-  const uint32_t plane = (uint32_t)Vt * (uint32_t)Vt;
-
   for (uint16_t O = 0; O < n_outputs; O++) {
     float *out_plane = noodle_slice(output, Vt, O);
 
-    for (uint32_t i = 0; i < plane; i++) {
-      out_plane[i] = 0.0f;
-    }
-
+    // The first input channel overwrites the plane, so it needs no zero-fill.
     for (uint16_t I = 0; I < n_inputs; I++) {
       float *in_plane = noodle_slice(input, W, I);
 
       const float *kernel =
           conv.weight + ((uint32_t)O * n_inputs + I) * conv.K * conv.K;
 
-      noodle_do_conv_transpose(in_plane, kernel, conv.K, W, out_plane, conv.P, conv.S, conv.OP);
+      noodle_do_conv_transpose(in_plane, kernel, conv.K, W, out_plane, conv.P, conv.S, conv.OP, I > 0);
 
       if (progress_cb) {
         progress_cb(progress);
@@ -1008,19 +2396,178 @@ uint16_t noodle_conv_transpose_float(float *input,
     }
 
     const float bias = conv.bias ? conv.bias[O] : 0.0f;
+    noodle_do_bias_act(out_plane, bias, Vt, conv.act);
+  }
 
-    for (uint32_t i = 0; i < plane; i++) {
-      float v = out_plane[i] + bias;
+  if (progress_cb) progress_cb(1.0f);
+  return Vt;
+}
 
-      if ((conv.act == ACT_RELU) && (v < 0.0f)) {
-        v = 0.0f;
+// File-input transpose Conv2D. Output planes are about S*S times larger than
+// input planes, so only B of them are kept: noodle_conv_plan() splits the
+// conv budget between R resident input planes and B output accumulators, as
+// for file-input Conv2D. Without a plan, one output plane in temp_buff2 is
+// filled per output channel while the input (and file weights) are streamed.
+// Finished planes go through the write-behind buffer in order. fi and fo,
+// and fw/fb when src.weight is NULL, must be open.
+static uint16_t noodle_conv_transpose_file(uint16_t n_inputs,
+                                           uint16_t n_outputs,
+                                           uint16_t W,
+                                           uint16_t K,
+                                           uint16_t P,
+                                           uint16_t S,
+                                           uint16_t OP,
+                                           Activation act,
+                                           const NoodleConvSrc &src,
+                                           CBFPtr progress_cb) {
+  uint16_t P0, P1;
+  const uint16_t Vt = noodle_compute_Vt_and_P(K, W, P, S, OP, P0, P1);
+  if (Vt == 0 || n_inputs == 0) return 0;
+
+  const uint32_t in_plane = (uint32_t)W * W;
+  const uint32_t plane = (uint32_t)Vt * Vt;
+  const uint32_t KK = (uint32_t)K * K;
+  const uint32_t per_out = (uint32_t)n_inputs * KK;
+  const bool staged = (src.weight == NULL);
+
+  float *in_buffer = noodle_temp1_require(in_plane);
+  if (!in_buffer) return 0;
+
+  uint16_t R = 0, B = 1;
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, in_plane,
+                               plane + (staged ? per_out : 0) + 1, false, R, B);
+  if (!ws && staged && K > NOODLE_MAX_K) return 0;
+
+  float bias1 = 0.0f;
+  float *acc, *stage = NULL, *bias = &bias1;
+  if (ws) {
+    acc = ws + (uint32_t)R * in_plane;
+    stage = acc + (uint32_t)B * plane;
+    bias = stage + (staged ? (uint32_t)B * per_out : 0);
+  } else {
+    acc = noodle_temp2_require(plane);
+    if (!acc) return 0;
+  }
+
+  float kernel[NOODLE_MAX_K * NOODLE_MAX_K];
+  NoodleStream in_st, w_st;
+  if (!ws) {
+    noodle_stream_begin(&in_st, fi, in_buffer, in_plane,
+                        (uint32_t)n_inputs * in_plane, n_outputs, true, NOODLE_PREFETCH_DEPTH);
+    if (staged)
+      noodle_stream_begin(&w_st, fw, kernel, KK, per_out, n_outputs, false, n_inputs);
+  }
+
+  float progress = 0.0f;
+  const uint32_t total = (uint32_t)n_inputs * n_outputs;
+  const float progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+  uint32_t stream_pos = 0;
+  const uint32_t cache_stride = in_plane;
+
+  for (uint16_t O0 = 0; O0 < n_outputs; O0 = (uint16_t)(O0 + B)) {
+    const uint16_t nb = (n_outputs - O0 < B) ? (uint16_t)(n_outputs - O0) : B;
+    const float *wblock = NULL;
+    if (ws) {
+      wblock = noodle_conv_block_params(src, O0, nb, per_out, K, stage, bias);
+      if (O0 == 0) noodle_rewind_file(fi);
+      else noodle_conv_seek_stream(R, stream_pos);
+    } else if (staged) {
+      bias1 = noodle_read_float(fb);
+    } else {
+      bias1 = src.bias ? src.bias[O0] : 0.0f;
+      wblock = src.weight + (uint32_t)O0 * per_out;
+    }
+
+    for (uint16_t I = 0; I < n_inputs; I++) {
+      float *in = in_buffer;
+      if (!ws) {
+        in = noodle_stream_next(&in_st, NULL);
+      } else if (I < R) {
+        in = ws + (uint32_t)I * cache_stride;
+        if (O0 == 0) {
+          noodle_grid_from_file(fi, in, W);
+          if (I + 1 == R) stream_pos = (uint32_t)fi.position();
+        }
+      } else {
+        noodle_grid_from_file(fi, in, W);
       }
 
-      out_plane[i] = v;
+      for (uint16_t b = 0; b < nb; b++) {
+        const float *k = wblock ? wblock + (uint32_t)b * per_out + (uint32_t)I * KK
+                                : noodle_stream_next(&w_st, NULL);
+        noodle_do_conv_transpose(in, k, K, W, acc + (uint32_t)b * plane, P, S, OP, I > 0);
+
+        if (progress_cb) {
+          progress_cb(progress);
+          progress += progress_step;
+        }
+      }
+    }
+
+    for (uint16_t b = 0; b < nb; b++) {
+      float *out_plane = acc + (uint32_t)b * plane;
+      noodle_do_bias_act(out_plane, bias[b], Vt, act);
+      for (uint32_t i = 0; i < plane; i++) noodle_out_float(fo, out_plane[i]);
     }
   }
 
-  if (progress_cb) progress_cb(1.0f);
+  if (!ws) {
+    if (staged) noodle_stream_end(&w_st);
+    noodle_stream_end(&in_st);
+  }
+  return Vt;
+}
+
+uint16_t noodle_conv_transpose_float(const char *in_fn,
+                                     uint16_t n_inputs,
+                                     uint16_t n_outputs,
+                                     const char *out_fn,
+                                     uint16_t W,
+                                     const Conv &conv,
+                                     CBFPtr progress_cb) {
+  if (!in_fn || !out_fn) return 0;
+
+  fb = noodle_fs_open_cached(conv.bias_fn);
+  fw = noodle_fs_open_cached(conv.weight_fn);
+  fi = noodle_fs_open_read(in_fn);
+  fo = noodle_fs_open_write(out_fn);
+
+  uint16_t Vt = 0;
+  if (fb && fw && fi && fo) {
+    const NoodleConvSrc src = {NULL, NULL, false};
+    Vt = noodle_conv_transpose_file(n_inputs, n_outputs, W, conv.K, conv.P, conv.S, conv.OP,
+                                    conv.act, src, progress_cb);
+  }
+
+  noodle_fs_release(fw, conv.weight_fn);
+  noodle_fs_release(fb, conv.bias_fn);
+  if (fi) fi.close();
+  if (fo) noodle_out_close(fo);
+  return Vt;
+}
+
+uint16_t noodle_conv_transpose_float(const char *in_fn,
+                                     uint16_t n_inputs,
+                                     uint16_t n_outputs,
+                                     const char *out_fn,
+                                     uint16_t W,
+                                     const ConvMem &conv,
+                                     CBFPtr progress_cb) {
+  noodle_map_hint(conv.weight, (size_t)n_outputs * n_inputs * conv.K * conv.K);
+  if (!in_fn || !out_fn || !conv.weight) return 0;
+
+  fi = noodle_fs_open_read(in_fn);
+  fo = noodle_fs_open_write(out_fn);
+
+  uint16_t Vt = 0;
+  if (fi && fo) {
+    const NoodleConvSrc src = {conv.weight, conv.bias, false};
+    Vt = noodle_conv_transpose_file(n_inputs, n_outputs, W, conv.K, conv.P, conv.S, conv.OP,
+                                    conv.act, src, progress_cb);
+  }
+
+  if (fi) fi.close();
+  if (fo) noodle_out_close(fo);
   return Vt;
 }
 
@@ -1053,29 +2600,45 @@ uint16_t noodle_conv_float(const char *in_fn,
 
   if (!fi || !fo) {
     if (fi) fi.close();
-    if (fo) fo.close();
+    if (fo) noodle_out_close(fo);
     return 0;
   }
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
     fi.close();
-    fo.close();
+    noodle_out_close(fo);
     return 0;
   }
 
   uint16_t Vout = 0;
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
 
+  uint16_t R = 0, B = 1;
+  float *ws = noodle_conv_plan(n_inputs, n_outputs, (uint32_t)W * W,
+                             (uint32_t)Vconv * Vconv + (uint32_t)n_inputs * conv.K * conv.K + 1,
+                             false, R, B);
+  if (ws) {
+    const NoodleConvSrc src = {conv.weight, conv.bias, true};
+    Vout = noodle_conv2d_planned(in_buffer, false, n_inputs, n_outputs, W, conv.K,
+                                 conv.P, conv.S, conv.act, src, pool, NULL, ws, R, B,
+                                 progress_cb, progress_step);
+    fi.close();
+    noodle_out_close(fo);
+    return Vout;
+  }
+
+  NoodleStream in_st;
+  noodle_stream_begin(&in_st, fi, in_buffer, (uint32_t)W * W,
+                      (uint32_t)n_inputs * W * W, n_outputs, true, NOODLE_PREFETCH_DEPTH);
+
   for (uint16_t O = 0; O < n_outputs; O++) {
     noodle_reset_buffer(out_buffer, (uint16_t)(Vconv * Vconv));
 
     const float bias = conv.bias ? noodle_pgm_float(conv.bias, O) : 0.0f;
 
-    noodle_rewind_file(fi);
-
     for (uint16_t I = 0; I < n_inputs; I++) {
-      noodle_grid_from_file(fi, in_buffer, W);
+      float *in = noodle_stream_next(&in_st, NULL);
 
       const uint32_t kbase =
           ((uint32_t)O * (uint32_t)n_inputs + (uint32_t)I) *
@@ -1083,7 +2646,7 @@ uint16_t noodle_conv_float(const char *in_fn,
 
       noodle_copy_kernel_progmem(conv.weight, kbase, conv.K, (float *)kernel);
 
-      noodle_do_conv(in_buffer, (float *)kernel, conv.K, W,
+      noodle_do_conv(in, (float *)kernel, conv.K, W,
                      out_buffer,
                      conv.P,
                      conv.S);
@@ -1098,8 +2661,9 @@ uint16_t noodle_conv_float(const char *in_fn,
     Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
   }
 
+  noodle_stream_end(&in_st);
   fi.close();
-  fo.close();
+  noodle_out_close(fo);
 
   return Vout;
 }
@@ -1116,9 +2680,10 @@ uint16_t noodle_conv_float(float *input,
                            const ConvProgmem &conv,
                            const Pool &pool,
                            CBFPtr progress_cb) {
-  float *out_buffer = noodle_temp2_require((size_t)W * W);
+  const bool identity = noodle_pool_is_identity(pool);
+  float *out_buffer = identity ? nullptr : noodle_temp2_require((size_t)W * W);
 
-  if (!input || !output || !out_buffer || !conv.weight) return 0;
+  if (!input || !output || (!identity && !out_buffer) || !conv.weight) return 0;
 
   float progress = 0.0f;
   float progress_step = 0.0f;
@@ -1129,13 +2694,18 @@ uint16_t noodle_conv_float(float *input,
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) return 0;
+  if (!identity && (pool.T == 0 || Vconv < pool.M)) return 0;
 
-  const uint16_t Wo = (uint16_t)((Vconv - pool.M) / pool.T + 1);
+  const uint16_t Wo = identity ? Vconv : (uint16_t)((Vconv - pool.M) / pool.T + 1);
   uint16_t Vout = 0;
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
 
   for (uint16_t O = 0; O < n_outputs; O++) {
-    noodle_reset_buffer(out_buffer, (uint16_t)(Vconv * Vconv));
+    // temp_buff2 holds the pre-pooling plane; identity pooling accumulates
+    // straight into the output plane.
+    float *out_plane = noodle_slice(output, Wo, O);
+    float *acc = identity ? out_plane : out_buffer;
+    for (uint32_t p = 0; p < (uint32_t)Vconv * Vconv; p++) acc[p] = 0.0f;
 
     const float bias = conv.bias ? noodle_pgm_float(conv.bias, O) : 0.0f;
 
@@ -1147,7 +2717,82 @@ uint16_t noodle_conv_float(float *input,
           (uint32_t)conv.K * (uint32_t)conv.K;
 
       noodle_copy_kernel_progmem(conv.weight, kbase, conv.K, (float *)kernel);
-      noodle_do_conv(in_plane, (float *)kernel,conv.K, W, out_buffer, conv.P, conv.S);
+      noodle_do_conv(in_plane, (float *)kernel,conv.K, W, acc, conv.P, conv.S);
+
+      if (progress_cb) {
+        progress_cb(progress);
+        progress += progress_step;
+      }
+    }
+
+    Vout = noodle_do_bias_act_pool(acc, bias, Vconv, conv.act, pool.M, pool.T, out_plane);
+  }
+
+  return Vout;
+}
+
+// ===== Packed container parameters =====
+
+// File -> file normal Conv2D, parameters from a .ndl container.
+// Each output channel costs one seek for its bias and one for its kernel row;
+// the row's n_inputs kernels are then read sequentially.
+uint16_t noodle_conv_float(const char *in_fn,
+                           uint16_t n_inputs,
+                           uint16_t n_outputs,
+                           const char *out_fn,
+                           uint16_t W,
+                           const ConvPacked &conv,
+                           const Pool &pool,
+                           CBFPtr progress_cb) {
+  float *in_buffer  = noodle_temp1_require((size_t)W * W);
+  float *out_buffer = noodle_temp2_require((size_t)W * W);
+
+  if (!in_fn || !out_fn || !in_buffer || !out_buffer) return 0;
+  if (!conv.model || !conv.model->file || !conv.weight) return 0;
+
+  NoodleModel &model = *conv.model;
+
+  float progress = 0.0f;
+  float progress_step = 0.0f;
+  if (progress_cb) {
+    const uint16_t total = n_inputs * n_outputs;
+    progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+  }
+
+  fi = noodle_fs_open_read(in_fn);
+  fo = noodle_fs_open_write(out_fn);
+
+  if (!fi || !fo) {
+    if (fi) fi.close();
+    if (fo) noodle_out_close(fo);
+    return 0;
+  }
+
+  const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
+  if (Vconv == 0) {
+    fi.close();
+    noodle_out_close(fo);
+    return 0;
+  }
+
+  uint16_t Vout = 0;
+  float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
+  const uint32_t KK = (uint32_t)conv.K * conv.K;
+
+  NoodleStream in_st;
+  noodle_stream_begin(&in_st, fi, in_buffer, (uint32_t)W * W,
+                      (uint32_t)n_inputs * W * W, n_outputs, true, NOODLE_PREFETCH_DEPTH);
+
+  for (uint16_t O = 0; O < n_outputs; O++) {
+    noodle_reset_buffer(out_buffer, (uint32_t)Vconv * Vconv);
+
+    const float bias = noodle_model_bias(model, conv.bias, O);
+    noodle_model_seek(model, conv.weight, (uint32_t)O * n_inputs * KK);
+
+    for (uint16_t I = 0; I < n_inputs; I++) {
+      float *in = noodle_stream_next(&in_st, NULL);
+      noodle_model_floats(model, (float *)kernel, KK);
+      noodle_do_conv(in, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
 
       if (progress_cb) {
         progress_cb(progress);
@@ -1156,9 +2801,71 @@ uint16_t noodle_conv_float(float *input,
     }
 
     noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
+    Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
+  }
+
+  noodle_stream_end(&in_st);
+  fi.close();
+  noodle_out_close(fo);
 
+  return Vout;
+}
+
+// RAM -> RAM normal Conv2D, parameters from a .ndl container.
+uint16_t noodle_conv_float(float *input,
+                           uint16_t n_inputs,
+                           uint16_t n_outputs,
+                           float *output,
+                           uint16_t W,
+                           const ConvPacked &conv,
+                           const Pool &pool,
+                           CBFPtr progress_cb) {
+  const bool identity = noodle_pool_is_identity(pool);
+  float *out_buffer = identity ? nullptr : noodle_temp2_require((size_t)W * W);
+
+  if (!input || !output || (!identity && !out_buffer)) return 0;
+  if (!conv.model || !conv.model->file || !conv.weight) return 0;
+
+  NoodleModel &model = *conv.model;
+
+  float progress = 0.0f;
+  float progress_step = 0.0f;
+  if (progress_cb) {
+    const uint16_t total = (uint16_t)(n_inputs * n_outputs);
+    progress_step = (total > 1) ? (1.0f / (float)(total - 1)) : 1.0f;
+  }
+
+  const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
+  if (Vconv == 0) return 0;
+  if (!identity && (pool.T == 0 || Vconv < pool.M)) return 0;
+
+  const uint16_t Wo = identity ? Vconv : (uint16_t)((Vconv - pool.M) / pool.T + 1);
+  uint16_t Vout = 0;
+  float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
+  const uint32_t KK = (uint32_t)conv.K * conv.K;
+
+  for (uint16_t O = 0; O < n_outputs; O++) {
+    // temp_buff2 holds the pre-pooling plane; identity pooling accumulates
+    // straight into the output plane.
     float *out_plane = noodle_slice(output, Wo, O);
-    Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, out_plane);
+    float *acc = identity ? out_plane : out_buffer;
+    for (uint32_t p = 0; p < (uint32_t)Vconv * Vconv; p++) acc[p] = 0.0f;
+
+    const float bias = noodle_model_bias(model, conv.bias, O);
+    noodle_model_seek(model, conv.weight, (uint32_t)O * n_inputs * KK);
+
+    for (uint16_t I = 0; I < n_inputs; I++) {
+      float *in_plane = noodle_slice(input, W, I);
+      noodle_model_floats(model, (float *)kernel, KK);
+      noodle_do_conv(in_plane, (float *)kernel, conv.K, W, acc, conv.P, conv.S);
+
+      if (progress_cb) {
+        progress_cb(progress);
+        progress += progress_step;
+      }
+    }
+
+    Vout = noodle_do_bias_act_pool(acc, bias, Vconv, conv.act, pool.M, pool.T, out_plane);
   }
 
   return Vout;
@@ -1252,6 +2959,25 @@ uint16_t noodle_conv_float(NoodleBuffer *input,
   return noodle_conv_float(input->data, n_inputs, n_outputs, out, W, conv, pool, progress_cb);
 }
 
+uint16_t noodle_conv_float(NoodleBuffer *input,
+                           uint16_t n_inputs,
+                           uint16_t n_outputs,
+                           NoodleBuffer *output,
+                           uint16_t W,
+                           const ConvPacked &conv,
+                           const Pool &pool,
+                           CBFPtr progress_cb) {
+  if (!input || !input->data || !output) return 0;
+
+  uint16_t Wout = 0;
+  float *out = noodle_buffer_require_conv2d_output(output, n_outputs, W,
+                                                   conv.K, conv.P, conv.S,
+                                                   pool, &Wout);
+  if (!out) return 0;
+
+  return noodle_conv_float(input->data, n_inputs, n_outputs, out, W, conv, pool, progress_cb);
+}
+
 uint16_t noodle_conv_transpose_float(NoodleBuffer *input,
                                      uint16_t n_inputs,
                                      uint16_t n_outputs,
@@ -25,33 +25,39 @@ uint16_t noodle_dwconv_float(const char *in_fn,
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
 
   fi = noodle_fs_open_read(in_fn);
-  fb = noodle_fs_open_read(conv.bias_fn);    
-  fw = noodle_fs_open_read(conv.weight_fn); 
+  fb = noodle_fs_open_cached(conv.bias_fn);    
+  fw = noodle_fs_open_cached(conv.weight_fn); 
   fo = noodle_fs_open_write(out_fn);
 
   if (!fi || !fb || !fw || !fo) {
     if (fi) fi.close();
-    if (fb) fb.close();
-    if (fw) fw.close();
-    if (fo) fo.close();
+    noodle_fs_release(fb, conv.bias_fn);
+    noodle_fs_release(fw, conv.weight_fn);
+    if (fo) noodle_out_close(fo);
     return 0;
   }
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
-    fi.close(); fw.close(); fb.close(); fo.close();
+    fi.close(); noodle_fs_release(fw, conv.weight_fn); noodle_fs_release(fb, conv.bias_fn); noodle_out_close(fo);
     return 0;
   }
 
   uint16_t Vout = 0;
 
+  NoodleStream in_st, w_st;
+  noodle_stream_begin(&in_st, fi, in_buffer, (uint32_t)W * W,
+                      (uint32_t)n_channels * W * W, 1, false, NOODLE_PREFETCH_DEPTH);
+  noodle_stream_begin(&w_st, fw, (float *)kernel, (uint32_t)conv.K * conv.K,
+                      (uint32_t)n_channels * conv.K * conv.K, 1, false, NOODLE_PREFETCH_DEPTH);
+
   for (uint16_t C = 0; C < n_channels; C++) {
-    noodle_grid_from_file(fi, in_buffer, W);
+    float *in = noodle_stream_next(&in_st, NULL);
     const float bias = noodle_read_float(fb);
-    noodle_grid_from_file(fw, (float *)kernel, conv.K);
+    const float *k = noodle_stream_next(&w_st, NULL);
 
     noodle_reset_buffer(out_buffer, Vconv * Vconv);
-    noodle_do_conv(in_buffer, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+    noodle_do_conv(in, k, conv.K, W, out_buffer, conv.P, conv.S);
 
     noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
     Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
@@ -60,10 +66,12 @@ uint16_t noodle_dwconv_float(const char *in_fn,
     progress += progress_step;
   }
 
+  noodle_stream_end(&w_st);
+  noodle_stream_end(&in_st);
   fi.close();
-  fw.close();
-  fb.close();
-  fo.close();
+  noodle_fs_release(fw, conv.weight_fn);
+  noodle_fs_release(fb, conv.bias_fn);
+  noodle_out_close(fo);
 
   return Vout;
 }
@@ -86,33 +94,37 @@ uint16_t noodle_dwconv_float(float *input,
 
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
 
-  NDL_File fb = noodle_fs_open_read(conv.bias_fn);
-  NDL_File fw = noodle_fs_open_read(conv.weight_fn);
+  NDL_File fb = noodle_fs_open_cached(conv.bias_fn);
+  NDL_File fw = noodle_fs_open_cached(conv.weight_fn);
   if (!fb || !fw) {
-    if (fb) fb.close();
-    if (fw) fw.close();
+    noodle_fs_release(fb, conv.bias_fn);
+    noodle_fs_release(fw, conv.weight_fn);
     return 0;
   }
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
-    fw.close();
-    fb.close();
+    noodle_fs_release(fw, conv.weight_fn);
+    noodle_fs_release(fb, conv.bias_fn);
     return 0;
   }
 
   const uint16_t Wo = (uint16_t)((Vconv - pool.M) / pool.T + 1);
   uint16_t Vout = 0;
 
+  NoodleStream w_st;
+  noodle_stream_begin(&w_st, fw, (float *)kernel, (uint32_t)conv.K * conv.K,
+                      (uint32_t)n_channels * conv.K * conv.K, 1, false, NOODLE_PREFETCH_DEPTH);
+
   for (uint16_t C = 0; C < n_channels; C++) {
     float *in_plane = noodle_slice(input, W, C);
 
     const float bias = noodle_read_float(fb);
-    noodle_grid_from_file(fw, (float *)kernel, conv.K);
+    const float *k = noodle_stream_next(&w_st, NULL);
 
     // temp_buff2 holds one pre-pooling output plane.
     noodle_reset_buffer(out_buffer, Vconv * Vconv);
-    noodle_do_conv(in_plane, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+    noodle_do_conv(in_plane, k, conv.K, W, out_buffer, conv.P, conv.S);
 
     noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
     float *out_plane = noodle_slice(output, Wo, C);
@@ -122,8 +134,9 @@ uint16_t noodle_dwconv_float(float *input,
     progress += progress_step;
   }
 
-  fw.close();
-  fb.close();
+  noodle_stream_end(&w_st);
+  noodle_fs_release(fw, conv.weight_fn);
+  noodle_fs_release(fb, conv.bias_fn);
   return Vout; 
 }
 
@@ -135,6 +148,7 @@ uint16_t noodle_dwconv_float(float *input,
                              const Pool &pool,
                              CBFPtr progress_cb)
 {
+  noodle_map_hint(conv.weight, (size_t)n_channels * conv.K * conv.K);
   float *out_buffer = noodle_temp2_require((size_t)W * W);
   if (!input || !output || !out_buffer || !conv.weight) return 0;
 
@@ -168,6 +182,99 @@ uint16_t noodle_dwconv_float(float *input,
   return Vout;
 }
 
+// ===== Fused depthwise -> pointwise block =====
+//
+// A MobileNet block is a depthwise KxK conv followed by a 1x1 conv. Running
+// the two layers back to back materializes the whole [C][V][V] depthwise map.
+// Here temp_buff3 holds only a band of depthwise rows for all C channels,
+// and each band goes straight through the pointwise SGEMM into the output
+// rows. Without pooling the band is as many rows as fit in
+// NOODLE_DWPW_BUFFER; with pooling each pooled output row takes the M
+// pointwise rows under its window (overlapping windows recompute the
+// shared rows). Sums are formed in the same order as the separate layers.
+
+uint16_t noodle_dwpw_float(float *input,
+                           uint16_t n_channels,
+                           uint16_t n_outputs,
+                           float *output,
+                           uint16_t W,
+                           const ConvMem &dw,
+                           const ConvMem &pw,
+                           const Pool &pool,
+                           CBFPtr progress_cb) {
+  if (!input || !output || !dw.weight || !pw.weight) return 0;
+  if (pw.K != 1 || pw.S != 1 || (pw.P != 0 && pw.P != 65535)) return 0;
+
+  const uint16_t V = noodle_compute_V(dw.K, W, dw.P, dw.S);
+  if (V == 0) return 0;
+
+#if NOODLE_POOL_MODE == NOODLE_POOL_NONE
+  const uint16_t M = 1, T = 1;
+#else
+  const uint16_t M = pool.M, T = pool.T;
+#endif
+  const bool identity = (M == 1 && T == 1);
+  if (M == 0 || T == 0 || V < M) return 0;
+  const uint16_t Wo = (uint16_t)((V - M) / T + 1);
+
+  uint16_t band = M;
+  if (identity) {
+    const size_t fit = (size_t)NOODLE_DWPW_BUFFER / ((size_t)n_channels * V * sizeof(float));
+    band = (fit < 1) ? 1 : (fit > V ? V : (uint16_t)fit);
+  }
+  const uint32_t band_len = (uint32_t)band * V;
+  float *rows = noodle_temp3_require((size_t)n_channels * band_len +
+                                     (identity ? 0 : (size_t)n_outputs * band_len));
+  if (!rows) return 0;
+  float *acc = rows + (size_t)n_channels * band_len;
+
+  noodle_map_hint(dw.weight, (size_t)n_channels * dw.K * dw.K);
+  noodle_map_hint(pw.weight, (size_t)n_outputs * n_channels);
+
+  const uint32_t KK = (uint32_t)dw.K * dw.K;
+  const uint32_t VV = (uint32_t)V * V;
+  const uint16_t n_steps = identity ? (uint16_t)((V + band - 1) / band) : Wo;
+  float progress = 0.0f;
+  const float progress_step = (n_steps > 1) ? (1.0f / (float)(n_steps - 1)) : 1.0f;
+
+  for (uint16_t s = 0; s < n_steps; s++) {
+    const uint16_t r0 = identity ? (uint16_t)(s * band) : (uint16_t)(s * T);
+    const uint16_t r1 = (V - r0 < band) ? V : (uint16_t)(r0 + band);
+    const uint32_t n = (uint32_t)(r1 - r0) * V;
+
+    // Depthwise rows r0..r1-1 of every channel, biased and activated.
+    for (uint16_t c = 0; c < n_channels; c++) {
+      float *dst = rows + (uint32_t)c * n;
+      noodle_reset_buffer(dst, n);
+      noodle_do_conv_rows(noodle_slice(input, W, c), dw.weight + (uint32_t)c * KK,
+                          dw.K, W, dst, dw.P, dw.S, r0, r1);
+      const float bias = dw.bias ? dw.bias[c] : 0.0f;
+      for (uint16_t r = 0; r < r1 - r0; r++)
+        noodle_pool_bias_act_row(dst + (uint32_t)r * V, V, 1, 1, 1, bias, dw.act,
+                                 dst + (uint32_t)r * V);
+    }
+
+    if (identity) {
+      noodle_sgemm(n_outputs, n, n_channels, pw.weight, n_channels, rows, n,
+                   output + (uint32_t)r0 * V, VV, pw.bias, pw.act);
+    } else {
+      // Raw pointwise sums; the pooling helper adds bias and activation.
+      noodle_sgemm(n_outputs, n, n_channels, pw.weight, n_channels, rows, n,
+                   acc, n, nullptr, ACT_NONE);
+      for (uint16_t o = 0; o < n_outputs; o++)
+        noodle_pool_bias_act_row(acc + (uint32_t)o * n, V, 1, M, T,
+                                 pw.bias ? pw.bias[o] : 0.0f, pw.act,
+                                 noodle_slice(output, Wo, o) + (uint32_t)s * Wo);
+    }
+
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step;
+    }
+  }
+  return Wo;
+}
+
 // File -> file depthwise Conv2D, PROGMEM parameters.
 // Input layout:  [C][W][W]
 // Weight layout: [C][K][K]
@@ -192,29 +299,33 @@ uint16_t noodle_dwconv_float(const char *in_fn,
 
   if (!fi || !fo) {
     if (fi) fi.close();
-    if (fo) fo.close();
+    if (fo) noodle_out_close(fo);
     return 0;
   }
 
   const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
   if (Vconv == 0) {
     fi.close();
-    fo.close();
+    noodle_out_close(fo);
     return 0;
   }
 
   uint16_t Vout = 0;
   float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
 
+  NoodleStream in_st;
+  noodle_stream_begin(&in_st, fi, in_buffer, (uint32_t)W * W,
+                      (uint32_t)C * W * W, 1, false, NOODLE_PREFETCH_DEPTH);
+
   for (uint16_t c = 0; c < C; c++) {
-    noodle_grid_from_file(fi, in_buffer, W);
+    float *in = noodle_stream_next(&in_st, NULL);
     noodle_reset_buffer(out_buffer, (uint16_t)(Vconv * Vconv));
 
     const uint32_t kbase =
         (uint32_t)c * (uint32_t)conv.K * (uint32_t)conv.K;
 
     noodle_copy_kernel_progmem(conv.weight, kbase, conv.K, (float *)kernel);
-    noodle_do_conv(in_buffer, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+    noodle_do_conv(in, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
 
     const float bias = conv.bias ? noodle_pgm_float(conv.bias, c) : 0.0f;
     noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
@@ -227,8 +338,9 @@ uint16_t noodle_dwconv_float(const char *in_fn,
     }
   }
 
+  noodle_stream_end(&in_st);
   fi.close();
-  fo.close();
+  noodle_out_close(fo);
 
   return Vout;
 }
@@ -283,6 +395,123 @@ uint16_t noodle_dwconv_float(float *input,
 
   return Vout;
 }
+
+// File -> file depthwise Conv2D, parameters from a .ndl container.
+uint16_t noodle_dwconv_float(const char *in_fn,
+                             uint16_t C,
+                             const char *out_fn,
+                             uint16_t W,
+                             const ConvPacked &conv,
+                             const Pool &pool,
+                             CBFPtr progress_cb) {
+  float *in_buffer  = noodle_temp1_require((size_t)W * W);
+  float *out_buffer = noodle_temp2_require((size_t)W * W);
+
+  if (!in_fn || !out_fn || !in_buffer || !out_buffer) return 0;
+  if (!conv.model || !conv.model->file || !conv.weight) return 0;
+
+  NoodleModel &model = *conv.model;
+
+  float progress = 0.0f;
+  const float progress_step = (C > 1) ? (1.0f / (float)(C - 1)) : 1.0f;
+
+  fi = noodle_fs_open_read(in_fn);
+  fo = noodle_fs_open_write(out_fn);
+
+  if (!fi || !fo) {
+    if (fi) fi.close();
+    if (fo) noodle_out_close(fo);
+    return 0;
+  }
+
+  const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
+  if (Vconv == 0) {
+    fi.close();
+    noodle_out_close(fo);
+    return 0;
+  }
+
+  uint16_t Vout = 0;
+  float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
+  const uint32_t KK = (uint32_t)conv.K * conv.K;
+
+  NoodleStream in_st;
+  noodle_stream_begin(&in_st, fi, in_buffer, (uint32_t)W * W,
+                      (uint32_t)C * W * W, 1, false, NOODLE_PREFETCH_DEPTH);
+
+  for (uint16_t c = 0; c < C; c++) {
+    float *in = noodle_stream_next(&in_st, NULL);
+    noodle_reset_buffer(out_buffer, (uint32_t)Vconv * Vconv);
+
+    const float bias = noodle_model_bias(model, conv.bias, c);
+    noodle_model_seek(model, conv.weight, (uint32_t)c * KK);
+    noodle_model_floats(model, (float *)kernel, KK);
+    noodle_do_conv(in, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+
+    noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
+    Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, fo);
+
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step;
+    }
+  }
+
+  noodle_stream_end(&in_st);
+  fi.close();
+  noodle_out_close(fo);
+
+  return Vout;
+}
+
+// RAM -> RAM depthwise Conv2D, parameters from a .ndl container.
+uint16_t noodle_dwconv_float(float *input,
+                             uint16_t C,
+                             float *output,
+                             uint16_t W,
+                             const ConvPacked &conv,
+                             const Pool &pool,
+                             CBFPtr progress_cb) {
+  float *out_buffer = noodle_temp2_require((size_t)W * W);
+
+  if (!input || !output || !out_buffer) return 0;
+  if (!conv.model || !conv.model->file || !conv.weight) return 0;
+
+  NoodleModel &model = *conv.model;
+
+  float progress = 0.0f;
+  const float progress_step = (C > 1) ? (1.0f / (float)(C - 1)) : 1.0f;
+
+  const uint16_t Vconv = noodle_compute_V(conv.K, W, conv.P, conv.S);
+  if (Vconv == 0) return 0;
+
+  const uint16_t Wo = (uint16_t)((Vconv - pool.M) / pool.T + 1);
+  uint16_t Vout = 0;
+  float kernel[NOODLE_MAX_K][NOODLE_MAX_K];
+  const uint32_t KK = (uint32_t)conv.K * conv.K;
+
+  for (uint16_t c = 0; c < C; c++) {
+    float *in_plane  = noodle_slice(input, W, c);
+    float *out_plane = noodle_slice(output, Wo, c);
+
+    noodle_reset_buffer(out_buffer, (uint32_t)Vconv * Vconv);
+
+    const float bias = noodle_model_bias(model, conv.bias, c);
+    noodle_model_seek(model, conv.weight, (uint32_t)c * KK);
+    noodle_model_floats(model, (float *)kernel, KK);
+    noodle_do_conv(in_plane, (float *)kernel, conv.K, W, out_buffer, conv.P, conv.S);
+
+    noodle_do_bias_act(out_buffer, bias, Vconv, conv.act);
+    Vout = noodle_do_pooling(out_buffer, Vconv, pool.M, pool.T, out_plane);
+
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step;
+    }
+  }
+
+  return Vout;
+}
 // ===== NoodleBuffer smart tensor wrappers =====
 
 static uint16_t noodle_dw_pool_output_width_for_buffer(uint16_t Vconv, const Pool &pool) {
@@ -367,3 +596,42 @@ uint16_t noodle_dwconv_float(NoodleBuffer *input,
 
   return noodle_dwconv_float(input->data, C, out, W, conv, pool, progress_cb);
 }
+
+uint16_t noodle_dwconv_float(NoodleBuffer *input,
+                             uint16_t C,
+                             NoodleBuffer *output,
+                             uint16_t W,
+                             const ConvPacked &conv,
+                             const Pool &pool,
+                             CBFPtr progress_cb) {
+  if (!input || !input->data || !output) return 0;
+
+  uint16_t Wout = 0;
+  float *out = noodle_buffer_require_dwconv2d_output(output, C, W,
+                                                     conv.K, conv.P, conv.S,
+                                                     pool, &Wout);
+  if (!out) return 0;
+
+  return noodle_dwconv_float(input->data, C, out, W, conv, pool, progress_cb);
+}
+
+uint16_t noodle_dwpw_float(NoodleBuffer *input,
+                           uint16_t n_channels,
+                           uint16_t n_outputs,
+                           NoodleBuffer *output,
+                           uint16_t W,
+                           const ConvMem &dw,
+                           const ConvMem &pw,
+                           const Pool &pool,
+                           CBFPtr progress_cb) {
+  if (!input || !input->data || !output) return 0;
+
+  const uint16_t Vconv = noodle_compute_V(dw.K, W, dw.P, dw.S);
+  const uint16_t Wo = noodle_dw_pool_output_width_for_buffer(Vconv, pool);
+  if (Wo == 0) return 0;
+
+  float *out = noodle_buffer_require(output, (size_t)n_outputs * Wo * Wo);
+  if (!out) return 0;
+
+  return noodle_dwpw_float(input->data, n_channels, n_outputs, out, W, dw, pw, pool, progress_cb);
+}
@@ -15,8 +15,8 @@ uint16_t noodle_fcn(const int8_t *input,
   float progress = 0.0;
   float progress_step = 1.0f / (float)(n_outputs - 1);
 
-  fw = noodle_fs_open_read(fcn.weight_fn);
-  fb = noodle_fs_open_read(fcn.bias_fn);
+  fw = noodle_fs_open_cached(fcn.weight_fn);
+  fb = noodle_fs_open_cached(fcn.bias_fn);
   fo = noodle_fs_open_write(out_fn);
 
   for (uint16_t k = 0; k < n_outputs; k++) {
@@ -24,14 +24,14 @@ uint16_t noodle_fcn(const int8_t *input,
     for (uint16_t j = 0; j < n_inputs; j++)
       h += (float)input[j] * noodle_read_float(fw);
     if ((h < 0.0) && (fcn.act == ACT_RELU)) h = 0.0;
-    noodle_write_float(fo, h);
+    noodle_out_float(fo, h);
     if (progress_cb) progress_cb(progress);
     progress += progress_step;
   }
 
-  fo.close();
-  fw.close();
-  fb.close();
+  noodle_out_close(fo);
+  noodle_fs_release(fw, fcn.weight_fn);
+  noodle_fs_release(fb, fcn.bias_fn);
   return n_outputs;
 }
 
@@ -45,8 +45,8 @@ uint16_t noodle_fcn(const byte *input,
   float progress = 0;
   float progress_step = 1.0f / (float)(n_outputs - 1);
 
-  fw = noodle_fs_open_read(fcn.weight_fn);
-  fb = noodle_fs_open_read(fcn.bias_fn);
+  fw = noodle_fs_open_cached(fcn.weight_fn);
+  fb = noodle_fs_open_cached(fcn.bias_fn);
   fo = noodle_fs_open_write(out_fn);
 
   for (uint16_t k = 0; k < n_outputs; k++) {
@@ -54,14 +54,14 @@ uint16_t noodle_fcn(const byte *input,
     for (uint16_t j = 0; j < n_inputs; j++)
       h += (float)input[j] * noodle_read_float(fw);
     if ((h < 0.0) && (fcn.act == ACT_RELU)) h = 0.0;
-    noodle_write_float(fo, h);
+    noodle_out_float(fo, h);
     if (progress_cb) progress_cb(progress);
     progress += progress_step;
   }
 
-  fo.close();
-  fw.close();
-  fb.close();
+  noodle_out_close(fo);
+  noodle_fs_release(fw, fcn.weight_fn);
+  noodle_fs_release(fb, fcn.bias_fn);
   return n_outputs;
 }
 
@@ -75,8 +75,8 @@ uint16_t noodle_fcn(const byte *input,
   float progress = 0;
   float progress_step = 1.0f / (float)(n_outputs - 1);
 
-  fw = noodle_fs_open_read(fcn.weight_fn);
-  fb = noodle_fs_open_read(fcn.bias_fn);
+  fw = noodle_fs_open_cached(fcn.weight_fn);
+  fb = noodle_fs_open_cached(fcn.bias_fn);
 
   for (uint16_t k = 0; k < n_outputs; k++) {
     output[k] = noodle_read_float(fb);
@@ -87,8 +87,8 @@ uint16_t noodle_fcn(const byte *input,
     progress += progress_step;
   }
 
-  fw.close();
-  fb.close();
+  noodle_fs_release(fw, fcn.weight_fn);
+  noodle_fs_release(fb, fcn.bias_fn);
 
   if (fcn.act == ACT_SOFTMAX) noodle_soft_max(output, n_outputs);
 
@@ -109,16 +109,19 @@ uint16_t noodle_fcn(const float *input,
                                 ? (1.0f / (float)(n_outputs - 1))
                                 : 1.0f;
 
-  fw = noodle_fs_open_read(fcn.weight_fn);
-  fb = noodle_fs_open_read(fcn.bias_fn);
+  fw = noodle_fs_open_cached(fcn.weight_fn);
+  fb = noodle_fs_open_cached(fcn.bias_fn);
 
   if (!fw || !fb) {
-    if (fw) fw.close();
-    if (fb) fb.close();
+    noodle_fs_release(fw, fcn.weight_fn);
+    noodle_fs_release(fb, fcn.bias_fn);
     return 0;
   }
 
   float wbuf[NOODLE_FCN_BLOCK];
+  NoodleStream w_st;
+  noodle_stream_begin(&w_st, fw, wbuf, NOODLE_FCN_BLOCK, n_inputs, n_outputs,
+                      false, NOODLE_PREFETCH_DEPTH);
 
   for (uint16_t k = 0; k < n_outputs; k++) {
     float h = noodle_read_float(fb);
@@ -130,13 +133,16 @@ uint16_t noodle_fcn(const float *input,
                             ? (uint16_t)NOODLE_FCN_BLOCK
                             : remain;
 
-      if (noodle_read_float_block(fw, wbuf, nb) != nb) {
-        fw.close();
-        fb.close();
+      uint32_t got = 0;
+      const float *wb = noodle_stream_next(&w_st, &got);
+      if (got != nb) {
+        noodle_stream_end(&w_st);
+        noodle_fs_release(fw, fcn.weight_fn);
+        noodle_fs_release(fb, fcn.bias_fn);
         return 0;
       }
 
-      h += noodle_dot_float_block(input + j, wbuf, nb);
+      h += noodle_dot_float_block(input + j, wb, nb);
       j = (uint16_t)(j + nb);
     }
 
@@ -149,8 +155,9 @@ uint16_t noodle_fcn(const float *input,
     }
   }
 
-  fw.close();
-  fb.close();
+  noodle_stream_end(&w_st);
+  noodle_fs_release(fw, fcn.weight_fn);
+  noodle_fs_release(fb, fcn.bias_fn);
 
   if (fcn.act == ACT_SOFTMAX) noodle_soft_max(output, n_outputs);
 
@@ -172,18 +179,21 @@ uint16_t noodle_fcn(const float *input,
                                 ? (1.0f / (float)(n_outputs - 1))
                                 : 1.0f;
 
-  fw = noodle_fs_open_read(fcn.weight_fn);
-  fb = noodle_fs_open_read(fcn.bias_fn);
+  fw = noodle_fs_open_cached(fcn.weight_fn);
+  fb = noodle_fs_open_cached(fcn.bias_fn);
   fo = noodle_fs_open_write(out_fn);
 
   if (!fw || !fb || !fo) {
-    if (fw) fw.close();
-    if (fb) fb.close();
-    if (fo) fo.close();
+    noodle_fs_release(fw, fcn.weight_fn);
+    noodle_fs_release(fb, fcn.bias_fn);
+    if (fo) noodle_out_close(fo);
     return 0;
   }
 
   float wbuf[NOODLE_FCN_BLOCK];
+  NoodleStream w_st;
+  noodle_stream_begin(&w_st, fw, wbuf, NOODLE_FCN_BLOCK, n_inputs, n_outputs,
+                      false, NOODLE_PREFETCH_DEPTH);
 
   for (uint16_t k = 0; k < n_outputs; k++) {
     float h = noodle_read_float(fb);
@@ -195,20 +205,23 @@ uint16_t noodle_fcn(const float *input,
                             ? (uint16_t)NOODLE_FCN_BLOCK
                             : remain;
 
-      if (noodle_read_float_block(fw, wbuf, nb) != nb) {
-        fw.close();
-        fb.close();
-        fo.close();
+      uint32_t got = 0;
+      const float *wb = noodle_stream_next(&w_st, &got);
+      if (got != nb) {
+        noodle_stream_end(&w_st);
+        noodle_fs_release(fw, fcn.weight_fn);
+        noodle_fs_release(fb, fcn.bias_fn);
+        noodle_out_close(fo);
         return 0;
       }
 
-      h += noodle_dot_float_block(input + j, wbuf, nb);
+      h += noodle_dot_float_block(input + j, wb, nb);
       j = (uint16_t)(j + nb);
     }
 
     if ((fcn.act == ACT_RELU) && (h < 0.0f)) h = 0.0f;
 
-    noodle_write_float(fo, h);
+    noodle_out_float(fo, h);
 
     if (progress_cb) {
       progress_cb(progress);
@@ -216,9 +229,10 @@ uint16_t noodle_fcn(const float *input,
     }
   }
 
-  fw.close();
-  fb.close();
-  fo.close();
+  noodle_stream_end(&w_st);
+  noodle_fs_release(fw, fcn.weight_fn);
+  noodle_fs_release(fb, fcn.bias_fn);
+  noodle_out_close(fo);
   return n_outputs;
 }
 
@@ -232,8 +246,8 @@ uint16_t noodle_fcn(const char *in_fn,
   float progress = 0;
   float progress_step = 1.0f / (float)(n_inputs * n_outputs - 1);
 
-  fw = noodle_fs_open_read(fcn.weight_fn);
-  fb = noodle_fs_open_read(fcn.bias_fn);
+  fw = noodle_fs_open_cached(fcn.weight_fn);
+  fb = noodle_fs_open_cached(fcn.bias_fn);
   fi = noodle_fs_open_read(in_fn);
 
   for (uint16_t j = 0; j < n_outputs; j++) {
@@ -247,8 +261,8 @@ uint16_t noodle_fcn(const char *in_fn,
   }
 
   fi.close();
-  fw.close();
-  fb.close();
+  noodle_fs_release(fw, fcn.weight_fn);
+  noodle_fs_release(fb, fcn.bias_fn);
 
   if (fcn.act == ACT_SOFTMAX) noodle_soft_max(output, n_outputs);
 
@@ -265,8 +279,8 @@ uint16_t noodle_fcn(const int8_t *input,
   float progress = 0;
   float progress_step = 1.0f / (float)(n_inputs * n_outputs - 1);
 
-  fw = noodle_fs_open_read(fcn.weight_fn);
-  fb = noodle_fs_open_read(fcn.bias_fn);
+  fw = noodle_fs_open_cached(fcn.weight_fn);
+  fb = noodle_fs_open_cached(fcn.bias_fn);
 
   for (uint16_t j = 0; j < n_outputs; j++) {
     output[j] = noodle_read_float(fb);
@@ -277,8 +291,8 @@ uint16_t noodle_fcn(const int8_t *input,
     progress += progress_step;
   }
 
-  fw.close();
-  fb.close();
+  noodle_fs_release(fw, fcn.weight_fn);
+  noodle_fs_release(fb, fcn.bias_fn);
 
   if (fcn.act == ACT_SOFTMAX) noodle_soft_max(output, n_outputs);
 
@@ -295,8 +309,8 @@ uint16_t noodle_fcn(const char *in_fn,
   float progress = 0;
   float progress_step = 1.0f / (float)(n_inputs * n_outputs - 1);
 
-  fw = noodle_fs_open_read(fcn.weight_fn);
-  fb = noodle_fs_open_read(fcn.bias_fn);
+  fw = noodle_fs_open_cached(fcn.weight_fn);
+  fb = noodle_fs_open_cached(fcn.bias_fn);
   fo = noodle_fs_open_write(out_fn);
   fi = noodle_fs_open_read(in_fn);
 
@@ -306,15 +320,15 @@ uint16_t noodle_fcn(const char *in_fn,
     for (uint16_t k = 0; k < n_inputs; k++)
       h += noodle_read_float(fi) * noodle_read_float(fw);
     if ((h < 0.0) && (fcn.act == ACT_RELU)) h = 0.0;
-    noodle_write_float(fo, h);
+    noodle_out_float(fo, h);
     if (progress_cb) progress_cb(progress);
     progress += progress_step;
   }
 
   fi.close();
-  fo.close();
-  fw.close();
-  fb.close();
+  noodle_out_close(fo);
+  noodle_fs_release(fw, fcn.weight_fn);
+  noodle_fs_release(fb, fcn.bias_fn);
   return n_outputs;
 }
 
@@ -325,6 +339,7 @@ uint16_t noodle_fcn(const float *input,
                     float *output,
                     const FCNMem &fcn,
                     CBFPtr progress_cb) {
+  noodle_map_hint(fcn.weight, (size_t)n_outputs * n_inputs);
   float progress = 0;
   float progress_step = 1.0f / (float)(n_outputs - 1);
 
@@ -437,6 +452,74 @@ uint16_t noodle_fcn_progmem(const float *input,
   return n_outputs;
 }
 
+// Memory -> memory, parameters from a .ndl container. Weights are read in one
+// sequential pass into the outputs, then biases in a second pass, so the layer
+// costs two seeks regardless of its size.
+uint16_t noodle_fcn(const float *input,
+                    uint16_t n_inputs,
+                    uint16_t n_outputs,
+                    float *output,
+                    const FCNPacked &fcn,
+                    CBFPtr progress_cb) {
+  if (!input || !output) return 0;
+  if (!fcn.model || !fcn.model->file || !fcn.weight) return 0;
+
+  NoodleModel &model = *fcn.model;
+
+  float progress = 0.0f;
+  const float progress_step = (n_outputs > 1)
+                                ? (1.0f / (float)(n_outputs - 1))
+                                : 1.0f;
+
+  float wbuf[NOODLE_FCN_BLOCK];
+  if (!noodle_model_seek(model, fcn.weight, 0)) return 0;
+
+  for (uint16_t k = 0; k < n_outputs; k++) {
+    float h = 0.0f;
+
+    uint16_t j = 0;
+    while (j < n_inputs) {
+      const uint16_t remain = (uint16_t)(n_inputs - j);
+      const uint16_t nb = (remain > (uint16_t)NOODLE_FCN_BLOCK)
+                            ? (uint16_t)NOODLE_FCN_BLOCK
+                            : remain;
+
+      if (noodle_model_floats(model, wbuf, nb) != nb) return 0;
+
+      h += noodle_dot_float_block(input + j, wbuf, nb);
+      j = (uint16_t)(j + nb);
+    }
+
+    output[k] = h;
+
+    if (progress_cb) {
+      progress_cb(progress);
+      progress += progress_step;
+    }
+  }
+
+  if (fcn.bias) {
+    noodle_model_seek(model, fcn.bias, 0);
+    for (uint16_t k = 0; k < n_outputs; k += NOODLE_FCN_BLOCK) {
+      const uint16_t remain = (uint16_t)(n_outputs - k);
+      const uint16_t nb = (remain > (uint16_t)NOODLE_FCN_BLOCK)
+                            ? (uint16_t)NOODLE_FCN_BLOCK
+                            : remain;
+      noodle_model_floats(model, wbuf, nb);
+      for (uint16_t i = 0; i < nb; i++) output[k + i] += wbuf[i];
+    }
+  }
+
+  if (fcn.act == ACT_RELU) {
+    for (uint16_t k = 0; k < n_outputs; k++) {
+      if (output[k] < 0.0f) output[k] = 0.0f;
+    }
+  }
+  if (fcn.act == ACT_SOFTMAX) noodle_soft_max(output, n_outputs);
+
+  return n_outputs;
+}
+
 
 // ===== NoodleBuffer smart tensor wrappers =====
 
@@ -476,6 +559,18 @@ uint16_t noodle_fcn(NoodleBuffer *input,
   return noodle_fcn(input->data, n_inputs, n_outputs, out, fcn, progress_cb);
 }
 
+uint16_t noodle_fcn(NoodleBuffer *input,
+                    uint16_t n_inputs,
+                    uint16_t n_outputs,
+                    NoodleBuffer *output,
+                    const FCNPacked &fcn,
+                    CBFPtr progress_cb) {
+  if (!input || !input->data || !output) return 0;
+  float *out = noodle_buffer_require(output, (size_t)n_outputs);
+  if (!out) return 0;
+  return noodle_fcn(input->data, n_inputs, n_outputs, out, fcn, progress_cb);
+}
+
 uint16_t noodle_fcn_progmem(NoodleBuffer *input,
                             uint16_t n_inputs,
                             uint16_t n_outputs,
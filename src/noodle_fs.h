@@ -5,8 +5,8 @@
  * @brief Small compatibility layer over the storage backends used by Noodle.
  *
  * Noodle reads and writes model tensors through a tiny common API so the same
- * higher-level code can run on SdFat, SD_MMC, FFat, LittleFS, or with storage
- * disabled. This header selects the backend-specific includes and exposes:
+ * higher-level code can run on SdFat, SD_MMC, FFat, LittleFS, POSIX stdio, an
+ * in-memory RAM disk, or with storage disabled. This header selects the backend-specific includes and exposes:
  *
  * - @ref NDL_File, the file-handle type used by the public API.
  * - `NOODLE_FS`, the selected filesystem object or singleton for real backends.
@@ -19,8 +19,20 @@
  * - `NOODLE_USE_SD_MMC`
  * - `NOODLE_USE_FFAT`
  * - `NOODLE_USE_LITTLEFS`
+ * - `NOODLE_USE_POSIX`
+ * - `NOODLE_USE_RAMDISK`
  * - `NOODLE_USE_NONE`
  *
+ * `NOODLE_USE_POSIX` wraps C stdio `FILE *` handles. It is intended for host
+ * builds (Linux/macOS workstations, CI runners) so file-streamed layers can be
+ * profiled and regression-tested without a board, and it also works on targets
+ * that expose a stdio-compatible VFS such as ESP-IDF mount points.
+ *
+ * `NOODLE_USE_RAMDISK` keeps files in heap memory and charges every open, seek,
+ * and transfer to a virtual clock using a configurable storage cost model. It
+ * lets CI machines predict how file-streamed layers behave on a given card and
+ * compare I/O-scheduling changes deterministically. See @ref noodle_ramdisk.
+ *
  * When using the main `noodle.h` entry point, `noodle_config.h` is included
  * first and selects `NOODLE_USE_SDFAT` by default if no backend macro is set.
  * If this header is included directly, the caller must define one backend
@@ -50,10 +62,11 @@
  * @brief Whether the selected backend expects normalized paths to start with '/'.
  * @ingroup noodle_fs
  *
- * SdFat is treated as accepting bare filenames. Other real Arduino filesystem
- * backends are normalized to slash-prefixed paths.
+ * SdFat, POSIX stdio, and the RAM disk are treated as accepting bare
+ * filenames. Other real Arduino filesystem backends are normalized to
+ * slash-prefixed paths.
  */
-#if defined(NOODLE_USE_SDFAT)
+#if defined(NOODLE_USE_SDFAT) || defined(NOODLE_USE_POSIX) || defined(NOODLE_USE_RAMDISK)
   #define NOODLE_FS_NEEDS_LEADING_SLASH 0
 #else
   #define NOODLE_FS_NEEDS_LEADING_SLASH 1
@@ -74,8 +87,8 @@
 // ------------------------------
 // 1) Enforce "exactly one"
 // ------------------------------
-#if (defined(NOODLE_USE_SDFAT) + defined(NOODLE_USE_SD_MMC) + defined(NOODLE_USE_FFAT) + defined(NOODLE_USE_LITTLEFS) + defined(NOODLE_USE_NONE)) != 1
-# error "Select exactly ONE backend: NOODLE_USE_SDFAT, NOODLE_USE_SD_MMC, NOODLE_USE_FFAT, NOODLE_USE_LITTLEFS, or NOODLE_USE_NONE"
+#if (defined(NOODLE_USE_SDFAT) + defined(NOODLE_USE_SD_MMC) + defined(NOODLE_USE_FFAT) + defined(NOODLE_USE_LITTLEFS) + defined(NOODLE_USE_POSIX) + defined(NOODLE_USE_RAMDISK) + defined(NOODLE_USE_NONE)) != 1
+# error "Select exactly ONE backend: NOODLE_USE_SDFAT, NOODLE_USE_SD_MMC, NOODLE_USE_FFAT, NOODLE_USE_LITTLEFS, NOODLE_USE_POSIX, NOODLE_USE_RAMDISK, or NOODLE_USE_NONE"
 #endif
 
 // ------------------------------
@@ -121,9 +134,345 @@
 
   // No NOODLE_FS symbol in NONE mode.
 
+// ------------------------------
+// 3) POSIX stdio backend
+// ------------------------------
+#elif defined(NOODLE_USE_POSIX)
+  #include <stdio.h>
+
+  /**
+   * @brief User-space stdio buffer size, in bytes, for POSIX file handles.
+   * @ingroup noodle_fs
+   *
+   * Applied with `setvbuf()` right after each open. Larger values reduce the
+   * number of `read()`/`write()` system calls issued for scalar-at-a-time
+   * access. Set it to 0 to disable stdio buffering, so every Noodle read or
+   * write reaches the kernel; this is useful when profiling the worst case of
+   * a driver with no block cache.
+   */
+  #ifndef NOODLE_POSIX_BUFFER
+    #define NOODLE_POSIX_BUFFER 4096
+  #endif
+
+  /**
+   * @brief File handle wrapping a C stdio `FILE *` stream.
+   * @ingroup noodle_fs
+   *
+   * Implements the File/FsFile method subset used by Noodle on top of stdio.
+   * Copies share the same stream, like Arduino `File` handles; close it once
+   * through any copy and do not use the other copies afterwards. Streams are
+   * opened in binary mode so BIN tensors round-trip byte-for-byte.
+   */
+  struct NDL_PosixFile {
+    FILE *_fp = nullptr;
+
+    operator bool() const { return _fp != nullptr; }
+
+    int available() {
+      if (!_fp) return 0;
+      const long pos = ftell(_fp);
+      const long end = (long)size();
+      return (pos >= 0 && end > pos) ? (int)(end - pos) : 0;
+    }
+
+    int read() { return _fp ? fgetc(_fp) : -1; }
+
+    size_t read(uint8_t *dst, size_t n) {
+      return _fp ? fread(dst, 1, n, _fp) : 0;
+    }
+
+    int peek() {
+      if (!_fp) return -1;
+      const int c = fgetc(_fp);
+      if (c != EOF) ungetc(c, _fp);
+      return c;
+    }
+
+    size_t readBytes(char *dst, size_t n) { return read((uint8_t *)dst, n); }
+
+    size_t write(uint8_t v) {
+      return (_fp && fputc(v, _fp) != EOF) ? 1 : 0;
+    }
+
+    size_t write(const uint8_t *src, size_t n) {
+      return _fp ? fwrite(src, 1, n, _fp) : 0;
+    }
+
+    void flush() { if (_fp) fflush(_fp); }
+
+    void close() {
+      if (_fp) fclose(_fp);
+      _fp = nullptr;
+    }
+
+    size_t size() {
+      if (!_fp) return 0;
+      const long pos = ftell(_fp);
+      if (pos < 0 || fseek(_fp, 0, SEEK_END) != 0) return 0;
+      const long end = ftell(_fp);
+      fseek(_fp, pos, SEEK_SET);
+      return (end > 0) ? (size_t)end : 0;
+    }
+
+    size_t position() {
+      if (!_fp) return 0;
+      const long pos = ftell(_fp);
+      return (pos > 0) ? (size_t)pos : 0;
+    }
+
+    bool seek(uint32_t pos) {
+      return _fp && fseek(_fp, (long)pos, SEEK_SET) == 0;
+    }
+
+    // Arduino Print::println() terminates lines with "\r\n"; keep TEXT files
+    // byte-compatible with files produced on the boards.
+    size_t println(uint8_t v) {
+      const int n = _fp ? fprintf(_fp, "%u\r\n", (unsigned)v) : -1;
+      return (n > 0) ? (size_t)n : 0;
+    }
+    size_t println(float v) { return println(v, 2); }
+    size_t println(float v, int digits) {
+      const int n = _fp ? fprintf(_fp, "%.*f\r\n", digits, (double)v) : -1;
+      return (n > 0) ? (size_t)n : 0;
+    }
+  };
+
+  /**
+   * @brief File-handle type used by Noodle file APIs.
+   * @ingroup noodle_fs
+   */
+  using NDL_File = NDL_PosixFile;
+
+  /**
+   * @brief Open a stdio stream and apply the configured buffering.
+   * @ingroup noodle_fs
+   *
+   * @param path Normalized path.
+   * @param mode stdio mode string, for example `"rb"` or `"wb"`.
+   * @return Open handle, or an invalid handle on failure.
+   */
+  inline NDL_File noodle_posix_open(const char *path, const char *mode) {
+    NDL_File f;
+    f._fp = fopen(path, mode);
+    if (f._fp) {
+  #if NOODLE_POSIX_BUFFER > 0
+      setvbuf(f._fp, NULL, _IOFBF, (size_t)NOODLE_POSIX_BUFFER);
+  #else
+      setvbuf(f._fp, NULL, _IONBF, 0);
+  #endif
+    }
+    return f;
+  }
+
+  // No NOODLE_FS symbol in POSIX mode; paths resolve against the process CWD.
+
+// ------------------------------
+// 4) RAM-disk backend
+// ------------------------------
+#elif defined(NOODLE_USE_RAMDISK)
+
+  /**
+   * @defgroup noodle_ramdisk RAM-Disk Backend
+   * @ingroup noodle_fs
+   *
+   * @brief In-memory filesystem with a simulated storage clock.
+   *
+   * Files live in heap memory and are addressed by name. Every operation is
+   * charged to a virtual clock according to the active NoodleRamDiskCost:
+   * a fixed cost per open and per seek, a fixed cost per driver call, and a
+   * cost per transferred byte. Reading noodle_ramdisk_elapsed_us() before and
+   * after a layer call predicts its storage time on the modelled card, and
+   * noodle_ramdisk_get_stats() reports how the time was spent.
+   *
+   * The cost model is deliberately simple and deterministic. It does not
+   * model FAT cluster caches or card-internal latency spikes, so calibrate the
+   * preset values against one real measurement before trusting absolute
+   * numbers; relative A/B comparisons are meaningful without calibration.
+   */
+
+  /**
+   * @brief Maximum number of files stored by the RAM disk.
+   * @ingroup noodle_ramdisk
+   */
+  #ifndef NOODLE_RAMDISK_MAX_FILES
+    #define NOODLE_RAMDISK_MAX_FILES 64
+  #endif
+
+  /**
+   * @brief Maximum number of simultaneously open RAM-disk handles.
+   * @ingroup noodle_ramdisk
+   */
+  #ifndef NOODLE_RAMDISK_MAX_OPEN
+    #define NOODLE_RAMDISK_MAX_OPEN 16
+  #endif
+
+  /**
+   * @brief Storage cost model used by the RAM-disk virtual clock.
+   * @ingroup noodle_ramdisk
+   *
+   * All values are nanoseconds. A read or write of `n` bytes costs
+   * `call_ns + n * read_byte_ns` (or `write_byte_ns`), so both the number of
+   * driver calls and the transferred volume are visible in the result.
+   */
+  typedef struct {
+    uint32_t open_ns;        ///< Cost of one open, e.g. a FAT directory scan.
+    uint32_t seek_ns;        ///< Cost of one seek/rewind.
+    uint32_t call_ns;        ///< Fixed overhead of one read or write call.
+    uint32_t read_byte_ns;   ///< Cost per byte read.
+    uint32_t write_byte_ns;  ///< Cost per byte written.
+  } NoodleRamDiskCost;
+
+  /**
+   * @brief Counters accumulated by the RAM-disk backend.
+   * @ingroup noodle_ramdisk
+   */
+  typedef struct {
+    uint64_t elapsed_ns;     ///< Virtual storage time.
+    uint32_t opens;          ///< Number of successful opens.
+    uint32_t seeks;          ///< Number of seeks, including rewinds.
+    uint32_t read_calls;     ///< Number of read calls.
+    uint32_t write_calls;    ///< Number of write calls.
+    uint64_t bytes_read;     ///< Total bytes read.
+    uint64_t bytes_written;  ///< Total bytes written.
+  } NoodleRamDiskStats;
+
+  /**
+   * @brief File handle referring to an open RAM-disk slot.
+   * @ingroup noodle_ramdisk
+   *
+   * Copies refer to the same slot and share its position, like Arduino `File`
+   * handles.
+   */
+  struct NDL_RamFile {
+    int16_t _slot = -1;
+
+    operator bool() const;
+    int available();
+    int read();
+    size_t read(uint8_t *dst, size_t n);
+    int peek();
+    size_t readBytes(char *dst, size_t n) { return read((uint8_t *)dst, n); }
+    size_t write(uint8_t v) { return write(&v, 1); }
+    size_t write(const uint8_t *src, size_t n);
+    void flush() {}
+    void close();
+    size_t size();
+    size_t position();
+    bool seek(uint32_t pos);
+    size_t println(uint8_t v);
+    size_t println(float v) { return println(v, 2); }
+    size_t println(float v, int digits);
+  };
+
+  /**
+   * @brief File-handle type used by Noodle file APIs.
+   * @ingroup noodle_fs
+   */
+  using NDL_File = NDL_RamFile;
+
+  /**
+   * @brief Open a RAM-disk file.
+   * @ingroup noodle_ramdisk
+   * @param path Normalized path.
+   * @param write `true` to create or truncate the file for writing.
+   * @return Open handle, or an invalid handle when the file does not exist or
+   * the file/slot tables are full.
+   */
+  NDL_File noodle_ramdisk_open(const char *path, bool write);
+
+  /**
+   * @brief Remove a RAM-disk file and release its storage.
+   * @ingroup noodle_ramdisk
+   * @param path Normalized path.
+   * @return `true` when the file existed.
+   */
+  bool noodle_ramdisk_remove(const char *path);
+
+  /**
+   * @brief Create or replace a RAM-disk file from a memory block.
+   * @ingroup noodle_ramdisk
+   *
+   * This is the host-side loader for model files and inputs. It is not
+   * charged to the virtual clock.
+   *
+   * @param path File name.
+   * @param data Source bytes; may be `nullptr` when @p n is 0.
+   * @param n Number of bytes.
+   * @return `true` on success.
+   */
+  bool noodle_ramdisk_put(const char *path, const void *data, size_t n);
+
+  /**
+   * @brief Return the contents of a RAM-disk file without charging the clock.
+   * @ingroup noodle_ramdisk
+   * @param path File name.
+   * @param n Receives the file size in bytes. May be `nullptr`.
+   * @return Pointer to the file bytes, or `nullptr` when the file is missing.
+   * The pointer is invalidated by any later write to the same file.
+   */
+  const uint8_t *noodle_ramdisk_data(const char *path, size_t *n);
+
+  /**
+   * @brief Remove every RAM-disk file and close every handle.
+   * @ingroup noodle_ramdisk
+   */
+  void noodle_ramdisk_clear(void);
+
+  /**
+   * @brief Install the storage cost model. The clock is not reset.
+   * @ingroup noodle_ramdisk
+   * @param cost Cost model to use for later operations.
+   */
+  void noodle_ramdisk_set_cost(const NoodleRamDiskCost &cost);
+
+  /**
+   * @brief Cost model for an SD card on SPI at @p sck_mhz.
+   * @ingroup noodle_ramdisk
+   *
+   * Matches the SdFat path used by noodle_fs_init(cs_pin), which runs the bus
+   * at 4 MHz. Byte cost is the raw bit time; open, seek, and call overheads
+   * are typical SdFat figures for a class-10 card.
+   *
+   * @param sck_mhz SPI clock in MHz.
+   * @return Cost model.
+   */
+  NoodleRamDiskCost noodle_ramdisk_cost_sdspi(uint8_t sck_mhz);
+
+  /**
+   * @brief Cost model for an SD card on the ESP32 SDMMC host.
+   * @ingroup noodle_ramdisk
+   *
+   * @param bus_width Data lines in use, 1 or 4.
+   * @param clk_mhz Bus clock in MHz; noodle_fs_init() requests 20 MHz.
+   * @return Cost model.
+   */
+  NoodleRamDiskCost noodle_ramdisk_cost_sdmmc(uint8_t bus_width, uint8_t clk_mhz);
+
+  /**
+   * @brief Reset the virtual clock and all counters to zero.
+   * @ingroup noodle_ramdisk
+   */
+  void noodle_ramdisk_reset_clock(void);
+
+  /**
+   * @brief Return the virtual storage time since the last reset.
+   * @ingroup noodle_ramdisk
+   * @return Elapsed virtual time in microseconds.
+   */
+  uint64_t noodle_ramdisk_elapsed_us(void);
+
+  /**
+   * @brief Copy the current counters.
+   * @ingroup noodle_ramdisk
+   * @param out Destination; ignored when `nullptr`.
+   */
+  void noodle_ramdisk_get_stats(NoodleRamDiskStats *out);
+
+  // No NOODLE_FS symbol in RAMDISK mode.
+
 #else
 // ------------------------------
-// 3) Real backends
+// 5) Real Arduino backends
 // ------------------------------
   #if defined(NOODLE_USE_SDFAT)
     #include <SdFat.h>
@@ -166,7 +515,7 @@
 #endif
 
 // ------------------------------
-// 4) Unified API
+// 6) Unified API
 // ------------------------------
 /**
  * @brief Copy a C string into a bounded buffer with NUL-termination.
@@ -241,6 +590,10 @@ inline NDL_File noodle_fs_open_read(const char* path) {
 #if defined(NOODLE_USE_NONE)
   (void)path;
   return NDL_File{}; // invalid handle
+#elif defined(NOODLE_USE_POSIX)
+  return noodle_posix_open(path, "rb");
+#elif defined(NOODLE_USE_RAMDISK)
+  return noodle_ramdisk_open(path, false);
 #elif defined(NOODLE_USE_SDFAT)
   return NOODLE_FS.open(path, O_RDONLY);
 #else
@@ -248,12 +601,27 @@ inline NDL_File noodle_fs_open_read(const char* path) {
 #endif
 }
 
+/**
+ * @brief Close and forget a cached read handle for a path.
+ * @ingroup noodle_fs
+ *
+ * Called before a path is rewritten or removed so a later read does not reuse
+ * a stale handle. Idle handles are closed; a handle still checked out is
+ * detached from the cache and closed by its release. No-op when
+ * `NOODLE_FS_CACHE` is 0.
+ *
+ * @param path Normalized path.
+ */
+void noodle_fs_cache_drop(const char* path);
+
 /**
  * @brief Open a file for writing using the selected backend.
  * @ingroup noodle_fs
  *
- * The path is normalized with noodle_norm_filename() before opening. Existing
- * SdFat files are truncated. Other backends use their `FILE_WRITE` mode. In
+ * The path is normalized with noodle_norm_filename() before opening, and any
+ * cached read handle for it is dropped. Existing SdFat, POSIX, and RAM-disk
+ * files are truncated. Other backends use their `FILE_WRITE`
+ * mode. In
  * `NOODLE_USE_NONE` mode this returns an invalid `NDL_File`.
  *
  * @param path Filename or path.
@@ -261,9 +629,14 @@ inline NDL_File noodle_fs_open_read(const char* path) {
  */
 inline NDL_File noodle_fs_open_write(const char* path) {
   path = noodle_norm_filename(path);
+  noodle_fs_cache_drop(path);
 #if defined(NOODLE_USE_NONE)
   (void)path;
   return NDL_File{}; // invalid handle
+#elif defined(NOODLE_USE_POSIX)
+  return noodle_posix_open(path, "wb");
+#elif defined(NOODLE_USE_RAMDISK)
+  return noodle_ramdisk_open(path, true);
 #elif defined(NOODLE_USE_SDFAT)
   int flags = O_WRITE | O_CREAT | O_TRUNC;
   return NOODLE_FS.open(path, flags);
@@ -276,16 +649,22 @@ inline NDL_File noodle_fs_open_write(const char* path) {
  * @brief Remove a file using the selected backend.
  * @ingroup noodle_fs
  *
- * The path is normalized with noodle_norm_filename() before removal.
+ * The path is normalized with noodle_norm_filename() before removal, and any
+ * cached read handle for it is dropped.
  *
  * @param path Filename or path.
  * @return `true` when the selected backend reports that the file was removed.
  */
 inline bool noodle_fs_remove(const char* path) {
   path = noodle_norm_filename(path);
+  noodle_fs_cache_drop(path);
 #if defined(NOODLE_USE_NONE)
   (void)path;
   return false;
+#elif defined(NOODLE_USE_POSIX)
+  return remove(path) == 0;
+#elif defined(NOODLE_USE_RAMDISK)
+  return noodle_ramdisk_remove(path);
 #else
   return NOODLE_FS.remove(path);
 #endif
@@ -295,18 +674,37 @@ inline bool noodle_fs_remove(const char* path) {
  * @brief Rewind a file handle to position 0.
  * @ingroup noodle_fs
  *
- * SdFat exposes `seekSet(0)`, while Arduino `File` backends expose `seek(0)`.
- * In `NOODLE_USE_NONE` mode the handle is closed.
+ * SdFat exposes `seekSet(0)`, while Arduino `File` backends and the POSIX and
+ * RAM-disk wrappers expose `seek(0)`. In `NOODLE_USE_NONE` mode the handle is
+ * closed.
  *
  * @param fi Open file handle to rewind.
  */
 inline void noodle_rewind_file(NDL_File &fi) {
 #if defined(NOODLE_USE_SDFAT)
   fi.seekSet(0);
-#elif defined(NOODLE_USE_FFAT) || defined(NOODLE_USE_LITTLEFS) || defined(NOODLE_USE_SD_MMC) || defined(NOODLE_USE_SD)
+#elif defined(NOODLE_USE_FFAT) || defined(NOODLE_USE_LITTLEFS) || defined(NOODLE_USE_SD_MMC) || defined(NOODLE_USE_SD) || defined(NOODLE_USE_POSIX) || defined(NOODLE_USE_RAMDISK)
   fi.seek(0);
 #else
   // NOODLE_USE_NONE (or unknown backend): nothing to seek. Close the handle.
   fi.close();
 #endif
 }
+
+/**
+ * @brief Move a file handle to an absolute byte position.
+ * @ingroup noodle_fs
+ *
+ * Used by chunked readers that read ahead and must hand back unconsumed bytes.
+ *
+ * @param fi Open file handle.
+ * @param pos Absolute byte offset from the start of the file.
+ * @return `true` when the backend accepted the new position.
+ */
+inline bool noodle_seek_file(NDL_File &fi, uint32_t pos) {
+#if defined(NOODLE_USE_SDFAT)
+  return fi.seekSet(pos);
+#else
+  return fi.seek(pos);
+#endif
+}
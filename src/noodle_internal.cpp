@@ -14,33 +14,14 @@ SdFat NOODLE_FS;  // define the SdFat object declared in noodle_fs.h
 NDL_File fw, fb, fo, fi;
 void *temp_buff1 = NULL;
 void *temp_buff2 = NULL;
+void *temp_buff3 = NULL;
 size_t temp_buff1_capacity = 0;
 size_t temp_buff2_capacity = 0;
+size_t temp_buff3_capacity = 0;
+size_t conv_budget = NOODLE_CONV_BUDGET;
 
 // ===== Convolution private helpers moved from noodle_conv.cpp =====
 
-uint16_t noodle_do_conv1d(float *input,
-                          float *kernel,
-                          uint16_t W,
-                          uint16_t K,
-                          float *output,
-                          uint16_t P,
-                          uint16_t S) {
-  uint16_t V = (W - K + 2 * P) / S + 1;
-
-  for (uint16_t i = 0; i < V; i++) {
-    float acc = 0.0;
-    for (uint16_t k = 0; k < K; k++) {
-      int16_t idx = i * S + k - P;
-      float val = (idx < 0 || idx >= (int16_t)W) ? 0.0 : input[idx];
-      acc += val * kernel[k];
-    }
-    output[i] += acc;
-  }
-
-  return V;
-}
-
 uint16_t noodle_do_pooling1d(float *input,
                              uint16_t W,
                              uint16_t K,
@@ -55,10 +36,10 @@ uint16_t noodle_do_pooling1d(float *input,
     for (uint16_t k = 0; k < K; k++) {
       if (v < input[base + k]) v = input[base + k];
     }
-    noodle_write_float(fo, v);
+    noodle_out_float(fo, v);
   }
 
-  fo.close();
+  noodle_out_close(fo);
   return Wo;
 }
 
@@ -74,7 +55,7 @@ uint16_t noodle_do_pooling1d(float *input,
     for (uint16_t k = 0; k < K; k++) {
       if (v < input[base + k]) v = input[base + k];
     }
-    noodle_write_float(fo, v);
+    noodle_out_float(fo, v);
   }
   return Wo;
 }
@@ -183,8 +164,8 @@ uint16_t noodle_do_pooling(const float *input,
   fo = noodle_fs_open_write(fn);
   const uint32_t n = (uint32_t)W * (uint32_t)W;
   for (uint32_t i = 0; i < n; i++)
-    noodle_write_float(fo, input[i]);
-  fo.close();
+    noodle_out_float(fo, input[i]);
+  noodle_out_close(fo);
   return W;
 
 #else
@@ -212,7 +193,7 @@ uint16_t noodle_do_pooling(const float *input,
           if (v > vmax) vmax = v;
         }
       }
-      noodle_write_float(fo, vmax);
+      noodle_out_float(fo, vmax);
 
     #elif NOODLE_POOL_MODE == NOODLE_POOL_MEAN
       float acc = 0.0f;
@@ -222,12 +203,12 @@ uint16_t noodle_do_pooling(const float *input,
           acc += input[row + base_x + win_x];
         }
       }
-      noodle_write_float(fo, acc * inv_KK);
+      noodle_out_float(fo, acc * inv_KK);
     #endif
     }
   }
 
-  fo.close();
+  noodle_out_close(fo);
   return Wo;
 #endif
 }
@@ -242,7 +223,7 @@ uint16_t noodle_do_pooling(const float *input,
   // Identity pooling: write W*W values unchanged.
   const uint32_t n = (uint32_t)W * (uint32_t)W;
   for (uint32_t i = 0; i < n; i++) {
-    noodle_write_float(fo, input[i]);
+    noodle_out_float(fo, input[i]);
   }
   return W;
 
@@ -270,7 +251,7 @@ uint16_t noodle_do_pooling(const float *input,
           if (v > vmax) vmax = v;
         }
       }
-      noodle_write_float(fo, vmax);
+      noodle_out_float(fo, vmax);
 
     #elif NOODLE_POOL_MODE == NOODLE_POOL_MEAN
       float acc = 0.0f;
@@ -280,7 +261,7 @@ uint16_t noodle_do_pooling(const float *input,
           acc += input[row + base_x + win_x];
         }
       }
-      noodle_write_float(fo, acc * inv_KK);
+      noodle_out_float(fo, acc * inv_KK);
     #endif
     }
   }
@@ -310,6 +291,10 @@ uint16_t noodle_do_pooling(const float *input,
     return W;
   }
 
+#if NOODLE_SIMD
+  if (K == 2 && S == 2 && W >= 2 && noodle_simd_pool2(input, W, output)) return (uint16_t)(W / 2);
+#endif
+
   const uint16_t Wo = (uint16_t)((W - K) / S + 1);
 
   #if NOODLE_POOL_MODE == NOODLE_POOL_MEAN
@@ -352,32 +337,179 @@ uint16_t noodle_do_pooling(const float *input,
 #endif
 }
 
-uint16_t noodle_do_conv(byte *grid,
-                        const float *kernel,
-                        uint16_t K,
-                        uint16_t W,
-                        float *output,
-                        uint16_t P,
-                        uint16_t S) {
+// First output index whose window starts inside the plane, and one past the
+// last whose window also ends inside it. Outputs in [lo, hi) need no padding.
+static void noodle_conv_interior(uint16_t K, uint16_t W, uint16_t S,
+                                 uint16_t P0, uint16_t V,
+                                 uint16_t &lo, uint16_t &hi) {
+  lo = (uint16_t)((P0 + S - 1) / S);
+  if (lo > V) lo = V;
+  hi = lo;
+  if (W + P0 >= K) {
+    const uint32_t last = (uint32_t)(W + P0 - K) / S + 1;
+    hi = (last > V) ? V : (uint16_t)last;
+    if (hi < lo) hi = lo;
+  }
+}
+
+// One border output: clip the kernel window to the plane instead of testing
+// every tap. Skipped taps multiply zero padding.
+template <typename T>
+static float noodle_conv_border_px(const T *grid, const float *kernel,
+                                   uint16_t K, uint16_t W,
+                                   int32_t y0, int32_t x0) {
+  const int32_t k0 = (y0 < 0) ? -y0 : 0;
+  const int32_t l0 = (x0 < 0) ? -x0 : 0;
+  const int32_t k1 = ((int32_t)W - y0 < (int32_t)K) ? (int32_t)W - y0 : (int32_t)K;
+  const int32_t l1 = ((int32_t)W - x0 < (int32_t)K) ? (int32_t)W - x0 : (int32_t)K;
+
+  float v = 0.0f;
+  for (int32_t k = k0; k < k1; k++) {
+    const T *row = grid + (y0 + k) * (int32_t)W;
+    const float *kr = kernel + k * (int32_t)K;
+    for (int32_t l = l0; l < l1; l++) v += kr[l] * (float)row[x0 + l];
+  }
+  return v;
+}
+
+// Output columns accumulated together by the specialized interior loop.
+#define NOODLE_CONV_STRIP 32
+
+// Interior strip of n output columns for a fixed kernel: taps outermost, so
+// the column loop vectorizes, while each pixel still sums its taps in k, l
+// order. N > 0 makes the strip width a constant.
+template <typename T, uint16_t K, uint16_t S, uint16_t N>
+static void noodle_conv_strip(const T *x, const float *kernel, uint16_t W,
+                              float *out, uint16_t n) {
+  if (N) n = N;
+  float acc[NOODLE_CONV_STRIP];
+  for (uint16_t t = 0; t < n; t++) acc[t] = 0.0f;
+  for (uint16_t k = 0; k < K; k++) {
+    for (uint16_t l = 0; l < K; l++) {
+      const float w = kernel[k * K + l];
+      const T *row = x + (uint32_t)k * W + l;
+      for (uint16_t t = 0; t < n; t++) acc[t] += w * (float)row[(uint32_t)t * S];
+    }
+  }
+  for (uint16_t t = 0; t < n; t++) out[t] += acc[t];
+}
+
+#if NOODLE_SIMD
+// Vector rows exist for float planes only; byte planes keep the strips.
+static inline uint16_t noodle_conv_row_vec(const float *x, const float *kernel, uint16_t K,
+                                           uint16_t W, uint16_t S, float *out, uint16_t n) {
+  return noodle_simd_conv_row(x, kernel, K, W, S, out, n);
+}
+static inline uint16_t noodle_conv_row_vec(const byte *, const float *, uint16_t,
+                                           uint16_t, uint16_t, float *, uint16_t) {
+  return 0;
+}
+#endif
+
+// KT/ST fix the kernel width and stride at compile time so the interior taps
+// unroll into straight-line code; 0 takes them from the runtime arguments.
+// Output rows r0..r1-1 are accumulated, with row r0 at @p output.
+template <typename T, uint16_t KT, uint16_t ST>
+static uint16_t noodle_do_conv_plane(const T *grid,
+                                     const float *kernel,
+                                     uint16_t K,
+                                     uint16_t W,
+                                     float *output,
+                                     uint16_t P,
+                                     uint16_t S,
+                                     uint16_t r0,
+                                     uint16_t r1) {
+  if (KT) K = KT;
+  if (ST) S = ST;
+
   uint16_t P0, P1;
-  uint16_t V = noodle_compute_V_and_P(K, W, P, S, P0, P1);
+  const uint16_t V = noodle_compute_V_and_P(K, W, P, S, P0, P1);
+  if (r1 > V) r1 = V;
 
-  for (uint16_t i = 0; i < V; i++) {
-    for (uint16_t j = 0; j < V; j++) {
-      float v = 0.0f;
-      for (uint16_t k = 0; k < K; k++) {
-        for (uint16_t l = 0; l < K; l++) {
-          v += kernel[k * K + l] *
-               noodle_get_padded_x(grid, i * S + k, j * S + l, W, P0, P1);
-        }
+  uint16_t lo, hi;
+  noodle_conv_interior(K, W, S, P0, V, lo, hi);
+
+  for (uint16_t i = r0; i < r1; i++) {
+    const int32_t y0 = (int32_t)i * S - P0;
+    float *out = output + (uint32_t)(i - r0) * V;
+
+    if (i < lo || i >= hi) {
+      for (uint16_t j = 0; j < V; j++)
+        out[j] += noodle_conv_border_px(grid, kernel, K, W, y0, (int32_t)j * S - P0);
+      continue;
+    }
+
+    for (uint16_t j = 0; j < lo; j++)
+      out[j] += noodle_conv_border_px(grid, kernel, K, W, y0, (int32_t)j * S - P0);
+
+    // Interior: every tap is inside the plane.
+    uint16_t mid = lo;
+#if NOODLE_SIMD
+    mid += noodle_conv_row_vec(grid + y0 * (int32_t)W + ((int32_t)lo * S - P0),
+                               kernel, K, W, S, out + lo, (uint16_t)(hi - lo));
+#endif
+    const T *src = grid + y0 * (int32_t)W + ((int32_t)mid * S - P0);
+    if (KT) {
+      for (uint16_t j = mid; j < hi; j += NOODLE_CONV_STRIP) {
+        const T *x = src + (uint32_t)(j - mid) * S;
+        if (hi - j >= NOODLE_CONV_STRIP)
+          noodle_conv_strip<T, KT, ST, NOODLE_CONV_STRIP>(x, kernel, W, out + j, NOODLE_CONV_STRIP);
+        else
+          noodle_conv_strip<T, KT, ST, 0>(x, kernel, W, out + j, (uint16_t)(hi - j));
+      }
+    } else {
+      for (uint16_t j = mid; j < hi; j++, src += S) {
+        float v = 0.0f;
+        const T *row = src;
+        const float *kr = kernel;
+        for (uint16_t k = 0; k < K; k++, row += W, kr += K)
+          for (uint16_t l = 0; l < K; l++) v += kr[l] * (float)row[l];
+        out[j] += v;
       }
-      output[i * V + j] += v;
     }
+
+    for (uint16_t j = hi; j < V; j++)
+      out[j] += noodle_conv_border_px(grid, kernel, K, W, y0, (int32_t)j * S - P0);
   }
 
   return V;
 }
 
+// Pick a specialized kernel for the shapes our models use, else the generic one.
+template <typename T>
+static uint16_t noodle_do_conv_dispatch(const T *grid,
+                                        const float *kernel,
+                                        uint16_t K,
+                                        uint16_t W,
+                                        float *output,
+                                        uint16_t P,
+                                        uint16_t S,
+                                        uint16_t r0,
+                                        uint16_t r1) {
+#if NOODLE_CONV_SPECIALIZE
+  switch (K * 4 + S) {
+    case 1 * 4 + 1: return noodle_do_conv_plane<T, 1, 1>(grid, kernel, K, W, output, P, S, r0, r1);
+    case 1 * 4 + 2: return noodle_do_conv_plane<T, 1, 2>(grid, kernel, K, W, output, P, S, r0, r1);
+    case 3 * 4 + 1: return noodle_do_conv_plane<T, 3, 1>(grid, kernel, K, W, output, P, S, r0, r1);
+    case 3 * 4 + 2: return noodle_do_conv_plane<T, 3, 2>(grid, kernel, K, W, output, P, S, r0, r1);
+    case 5 * 4 + 1: return noodle_do_conv_plane<T, 5, 1>(grid, kernel, K, W, output, P, S, r0, r1);
+    case 5 * 4 + 2: return noodle_do_conv_plane<T, 5, 2>(grid, kernel, K, W, output, P, S, r0, r1);
+    default: break;
+  }
+#endif
+  return noodle_do_conv_plane<T, 0, 0>(grid, kernel, K, W, output, P, S, r0, r1);
+}
+
+uint16_t noodle_do_conv(byte *grid,
+                        const float *kernel,
+                        uint16_t K,
+                        uint16_t W,
+                        float *output,
+                        uint16_t P,
+                        uint16_t S) {
+  return noodle_do_conv_dispatch((const byte *)grid, kernel, K, W, output, P, S, 0, 0xFFFF);
+}
+
 uint16_t noodle_do_conv(float *grid,
                         const float *kernel,
                         uint16_t K,
@@ -385,25 +517,237 @@ uint16_t noodle_do_conv(float *grid,
                         float *output,
                         uint16_t P,
                         uint16_t S) {
+  return noodle_do_conv_dispatch((const float *)grid, kernel, K, W, output, P, S, 0, 0xFFFF);
+}
+
+uint16_t noodle_do_conv_rows(const float *grid,
+                             const float *kernel,
+                             uint16_t K,
+                             uint16_t W,
+                             float *output,
+                             uint16_t P,
+                             uint16_t S,
+                             uint16_t r0,
+                             uint16_t r1) {
+  return noodle_do_conv_dispatch(grid, kernel, K, W, output, P, S, r0, r1);
+}
+
+#if NOODLE_CONV_OBLOCK > 1
+// One output pixel for all B channels of the block. Each channel's taps are
+// summed from zero in (k, l) order and then added to the accumulator, like
+// noodle_do_conv(), so blocked and per-channel results are identical.
+template <uint16_t KT, bool CLIP>
+static inline void noodle_conv_block_px(const float *grid, const float *wp,
+                                        uint16_t K, uint16_t W,
+                                        int32_t y0, int32_t x0, float *acc) {
+  if (KT) K = KT;
+  const uint8_t B = NOODLE_CONV_OBLOCK;
+  float a[B];
+  for (uint8_t b = 0; b < B; b++) a[b] = 0.0f;
+
+  int32_t k0 = 0, l0 = 0, k1 = K, l1 = K;
+  if (CLIP) {
+    if (y0 < 0) k0 = -y0;
+    if (x0 < 0) l0 = -x0;
+    if ((int32_t)W - y0 < k1) k1 = (int32_t)W - y0;
+    if ((int32_t)W - x0 < l1) l1 = (int32_t)W - x0;
+  }
+  for (int32_t k = k0; k < k1; k++) {
+    const float *row = grid + (y0 + k) * (int32_t)W + x0;
+    const float *w = wp + (uint32_t)(k * K) * B;
+    for (int32_t l = l0; l < l1; l++) {
+      const float xv = row[l];
+      const float *wl = w + (uint32_t)l * B;
+      for (uint8_t b = 0; b < B; b++) a[b] += wl[b] * xv;
+    }
+  }
+  for (uint8_t b = 0; b < B; b++) acc[b] += a[b];
+}
+
+template <uint16_t KT, uint16_t ST>
+static uint16_t noodle_do_conv_block_plane(const float *grid,
+                                           const float *wp,
+                                           uint16_t K,
+                                           uint16_t W,
+                                           float *acc,
+                                           uint16_t P,
+                                           uint16_t S,
+                                           uint16_t r0,
+                                           uint16_t r1) {
+  if (KT) K = KT;
+  if (ST) S = ST;
+  const uint8_t B = NOODLE_CONV_OBLOCK;
+
   uint16_t P0, P1;
-  uint16_t V = noodle_compute_V_and_P(K, W, P, S, P0, P1);
+  const uint16_t V = noodle_compute_V_and_P(K, W, P, S, P0, P1);
+  if (V == 0) return 0;
+  if (r1 > V) r1 = V;
+
+  uint16_t lo, hi;
+  noodle_conv_interior(K, W, S, P0, V, lo, hi);
+
+  for (uint16_t i = r0; i < r1; i++) {
+    const int32_t y0 = (int32_t)i * S - P0;
+    float *out = acc + (uint32_t)(i - r0) * V * B;
+    const bool row_in = (i >= lo && i < hi);
+
+    uint16_t mid = lo;
+#if NOODLE_SIMD
+    if (row_in)
+      mid += noodle_simd_conv_block_row(grid + y0 * (int32_t)W + ((int32_t)lo * S - P0), wp,
+                                        K, W, S, out + (uint32_t)lo * B, (uint16_t)(hi - lo));
+#endif
+    for (uint16_t j = 0; j < V; j++) {
+      if (row_in && j >= lo && j < mid) continue;
+      const int32_t x0 = (int32_t)j * S - P0;
+      if (row_in && j >= lo && j < hi)
+        noodle_conv_block_px<KT, false>(grid, wp, K, W, y0, x0, out + (uint32_t)j * B);
+      else
+        noodle_conv_block_px<KT, true>(grid, wp, K, W, y0, x0, out + (uint32_t)j * B);
+    }
+  }
+  return V;
+}
+
+uint16_t noodle_do_conv_block_rows(const float *grid,
+                                   const float *wp,
+                                   uint16_t K,
+                                   uint16_t W,
+                                   float *acc,
+                                   uint16_t P,
+                                   uint16_t S,
+                                   uint16_t r0,
+                                   uint16_t r1) {
+#if NOODLE_CONV_SPECIALIZE
+  switch (K * 4 + S) {
+    case 1 * 4 + 1: return noodle_do_conv_block_plane<1, 1>(grid, wp, K, W, acc, P, S, r0, r1);
+    case 1 * 4 + 2: return noodle_do_conv_block_plane<1, 2>(grid, wp, K, W, acc, P, S, r0, r1);
+    case 3 * 4 + 1: return noodle_do_conv_block_plane<3, 1>(grid, wp, K, W, acc, P, S, r0, r1);
+    case 3 * 4 + 2: return noodle_do_conv_block_plane<3, 2>(grid, wp, K, W, acc, P, S, r0, r1);
+    case 5 * 4 + 1: return noodle_do_conv_block_plane<5, 1>(grid, wp, K, W, acc, P, S, r0, r1);
+    case 5 * 4 + 2: return noodle_do_conv_block_plane<5, 2>(grid, wp, K, W, acc, P, S, r0, r1);
+    default: break;
+  }
+#endif
+  return noodle_do_conv_block_plane<0, 0>(grid, wp, K, W, acc, P, S, r0, r1);
+}
+
+uint16_t noodle_do_conv_block(const float *grid,
+                              const float *wp,
+                              uint16_t K,
+                              uint16_t W,
+                              float *acc,
+                              uint16_t P,
+                              uint16_t S) {
+  return noodle_do_conv_block_rows(grid, wp, K, W, acc, P, S, 0, 0xFFFF);
+}
+#endif
+
+// ===== 1D convolution =====
+
+// Taps that fall in the zero padding are skipped rather than tested: samples
+// in [lo, hi) see the whole kernel and only the edge samples clip it. Each
+// sample still sums its taps from zero in k order before touching @p output.
+uint16_t noodle_do_conv1d(float *input,
+                          float *kernel,
+                          uint16_t W,
+                          uint16_t K,
+                          float *output,
+                          uint16_t P,
+                          uint16_t S) {
+  if (S == 0 || (uint32_t)W + 2u * P < K) return 0;
+  const uint16_t V = (uint16_t)(((uint32_t)W + 2u * P - K) / S + 1);
+
+  uint16_t lo, hi;
+  noodle_conv_interior(K, W, S, P, V, lo, hi);
 
   for (uint16_t i = 0; i < V; i++) {
-    for (uint16_t j = 0; j < V; j++) {
-      float v = 0.0f;
-      for (uint16_t k = 0; k < K; k++) {
-        for (uint16_t l = 0; l < K; l++) {
-          v += kernel[k * K + l] *
-               noodle_get_padded_x(grid, i * S + k, j * S + l, W, P0, P1);
-        }
-      }
-      output[i * V + j] += v;
+    const int32_t x0 = (int32_t)i * S - P;
+    int32_t k0 = 0, k1 = K;
+    if (i < lo || i >= hi) {
+      if (x0 < 0) k0 = -x0;
+      if ((int32_t)W - x0 < k1) k1 = (int32_t)W - x0;
     }
+    const float *x = input + x0;
+    float acc = 0.0f;
+    for (int32_t k = k0; k < k1; k++) acc += x[k] * kernel[k];
+    output[i] += acc;
   }
 
   return V;
 }
 
+#if NOODLE_CONV_OBLOCK > 1
+// One output sample for all B channels of the block, summed like
+// noodle_do_conv1d() so blocked and per-channel results are identical.
+template <uint16_t KT, bool CLIP>
+static inline void noodle_conv1d_block_px(const float *input, const float *wp,
+                                          uint16_t K, uint16_t W,
+                                          int32_t x0, float *acc) {
+  if (KT) K = KT;
+  const uint8_t B = NOODLE_CONV_OBLOCK;
+  float a[B];
+  for (uint8_t b = 0; b < B; b++) a[b] = 0.0f;
+
+  int32_t k0 = 0, k1 = K;
+  if (CLIP) {
+    if (x0 < 0) k0 = -x0;
+    if ((int32_t)W - x0 < k1) k1 = (int32_t)W - x0;
+  }
+  for (int32_t k = k0; k < k1; k++) {
+    const float xv = input[x0 + k];
+    const float *wk = wp + (uint32_t)k * B;
+    for (uint8_t b = 0; b < B; b++) a[b] += xv * wk[b];
+  }
+  for (uint8_t b = 0; b < B; b++) acc[b] += a[b];
+}
+
+template <uint16_t KT>
+static uint16_t noodle_do_conv1d_block_seq(const float *input,
+                                           const float *wp,
+                                           uint16_t K,
+                                           uint16_t W,
+                                           float *acc,
+                                           uint16_t P,
+                                           uint16_t S) {
+  if (KT) K = KT;
+  const uint8_t B = NOODLE_CONV_OBLOCK;
+  if (S == 0 || (uint32_t)W + 2u * P < K) return 0;
+  const uint16_t V = (uint16_t)(((uint32_t)W + 2u * P - K) / S + 1);
+
+  uint16_t lo, hi;
+  noodle_conv_interior(K, W, S, P, V, lo, hi);
+
+  for (uint16_t i = 0; i < lo; i++)
+    noodle_conv1d_block_px<KT, true>(input, wp, K, W, (int32_t)i * S - P, acc + (uint32_t)i * B);
+  for (uint16_t i = lo; i < hi; i++)
+    noodle_conv1d_block_px<KT, false>(input, wp, K, W, (int32_t)i * S - P, acc + (uint32_t)i * B);
+  for (uint16_t i = hi; i < V; i++)
+    noodle_conv1d_block_px<KT, true>(input, wp, K, W, (int32_t)i * S - P, acc + (uint32_t)i * B);
+  return V;
+}
+
+uint16_t noodle_do_conv1d_block(const float *input,
+                                const float *wp,
+                                uint16_t K,
+                                uint16_t W,
+                                float *acc,
+                                uint16_t P,
+                                uint16_t S) {
+#if NOODLE_CONV_SPECIALIZE
+  switch (K) {
+    case 1: return noodle_do_conv1d_block_seq<1>(input, wp, K, W, acc, P, S);
+    case 3: return noodle_do_conv1d_block_seq<3>(input, wp, K, W, acc, P, S);
+    case 5: return noodle_do_conv1d_block_seq<5>(input, wp, K, W, acc, P, S);
+    case 7: return noodle_do_conv1d_block_seq<7>(input, wp, K, W, acc, P, S);
+    case 9: return noodle_do_conv1d_block_seq<9>(input, wp, K, W, acc, P, S);
+    default: break;
+  }
+#endif
+  return noodle_do_conv1d_block_seq<0>(input, wp, K, W, acc, P, S);
+}
+#endif
+
 void noodle_reset_buffer(float *buffer,
                          uint16_t n) {
   for (uint16_t i = 0; i < n; i++) {
@@ -411,19 +755,338 @@ void noodle_reset_buffer(float *buffer,
   }
 }
 
+template <bool RELU>
+static void noodle_bias_act_plane(float *output, float bias, uint32_t count) {
+  for (uint32_t i = 0; i < count; ++i) {
+    float v = output[i] + bias;
+    if (RELU && v < 0.0f) v = 0.0f;
+    output[i] = v;
+  }
+}
+
 uint16_t noodle_do_bias_act(float *output,
                             float bias,
                             uint16_t n,
                             Activation act) {
-  for (uint16_t i = 0; i < n; ++i) {
-    float *row = output + i * n;
-    for (uint16_t j = 0; j < n; ++j) {
-      float v = row[j] + bias;
+  const uint32_t count = (uint32_t)n * n;
+#if NOODLE_SIMD
+  if (noodle_simd_affine(output, count, 1.0f, bias,
+                         (act == ACT_RELU) ? NOODLE_RELU_NEG : NOODLE_RELU_NONE))
+    return n;
+#endif
+  if (act == ACT_RELU) noodle_bias_act_plane<true>(output, bias, count);
+  else noodle_bias_act_plane<false>(output, bias, count);
+  return n;
+}
+
+static inline float noodle_bias_act_px(float v, float bias, Activation act) {
+  v += bias;
+  return (act == ACT_RELU && v < 0.0f) ? 0.0f : v;
+}
+
+uint16_t noodle_pool_bias_act_row(const float *acc,
+                                  uint16_t V,
+                                  uint8_t step,
+                                  uint16_t M,
+                                  uint16_t T,
+                                  float bias,
+                                  Activation act,
+                                  float *out) {
+#if NOODLE_POOL_MODE == NOODLE_POOL_NONE
+  M = 1;
+  T = 1;
+#endif
+  if (M == 1 && T == 1) {
+    for (uint16_t x = 0; x < V; x++) out[x] = noodle_bias_act_px(acc[(uint32_t)x * step], bias, act);
+    return V;
+  }
+  if (T == 0 || V < M) return 0;
+
+  const uint16_t Wo = (uint16_t)((V - M) / T + 1);
+  const uint32_t row = (uint32_t)V * step;
+#if NOODLE_POOL_MODE != NOODLE_POOL_MAX
+  const float inv_KK = 1.0f / (float)(M * M);
+#endif
+  for (uint16_t x = 0; x < Wo; x++) {
+    const float *win = acc + (uint32_t)x * T * step;
+#if NOODLE_POOL_MODE == NOODLE_POOL_MAX
+    // Bias and ReLU are monotone, so the window maximum of the raw sums
+    // picks the same value the pooled activations would.
+    float vmax = -FLT_MAX;
+    for (uint16_t wy = 0; wy < M; wy++)
+      for (uint16_t wx = 0; wx < M; wx++) {
+        const float v = win[wy * row + (uint32_t)wx * step];
+        if (v > vmax) vmax = v;
+      }
+    out[x] = noodle_bias_act_px(vmax, bias, act);
+#else
+    float s = 0.0f;
+    for (uint16_t wy = 0; wy < M; wy++)
+      for (uint16_t wx = 0; wx < M; wx++)
+        s += noodle_bias_act_px(win[wy * row + (uint32_t)wx * step], bias, act);
+    out[x] = s * inv_KK;
+#endif
+  }
+  return Wo;
+}
+
+uint16_t noodle_do_bias_act_pool(float *plane,
+                                 float bias,
+                                 uint16_t V,
+                                 Activation act,
+                                 uint16_t M,
+                                 uint16_t T,
+                                 float *output) {
+#if NOODLE_POOL_MODE == NOODLE_POOL_NONE
+  M = 1;
+  T = 1;
+#endif
+  if (M == 1 && T == 1) {
+    if (plane == output) return noodle_do_bias_act(plane, bias, V, act);
+    const uint32_t count = (uint32_t)V * V;
+    for (uint32_t i = 0; i < count; i++) output[i] = noodle_bias_act_px(plane[i], bias, act);
+    return V;
+  }
+#if NOODLE_POOL_MODE == NOODLE_POOL_MAX
+  // Pool the raw sums, then bias and activate the M*M times smaller map.
+  const uint16_t Wo = noodle_do_pooling(plane, V, M, T, output);
+  if (Wo) noodle_do_bias_act(output, bias, Wo, act);
+  return Wo;
+#else
+  if (T == 0 || V < M) return 0;
+  const uint16_t Wo = (uint16_t)((V - M) / T + 1);
+  for (uint16_t y = 0; y < Wo; y++)
+    noodle_pool_bias_act_row(plane + (uint32_t)y * T * V, V, 1, M, T, bias, act,
+                             output + (uint32_t)y * Wo);
+  return Wo;
+#endif
+}
+
+// ===== Blocked SGEMM =====
+
+// Register tile (rows x columns) and cache blocks (depth x columns). The B
+// panel of one block is NOODLE_GEMM_KC * NOODLE_GEMM_NC floats (32 KB).
+#define NOODLE_GEMM_MR 4
+#define NOODLE_GEMM_NR 8
+#define NOODLE_GEMM_KC 128
+#define NOODLE_GEMM_NC 64
+
+// One C tile of up to MR x NR over depth k0..k1. The first depth block starts
+// from zero, later ones continue the partial sums stored in C, so every
+// element adds its products in depth order. The last block adds the bias and
+// applies the activation.
+static void noodle_gemm_tile(uint16_t mr, uint16_t nr, uint32_t k0, uint32_t k1, bool last,
+                             const float *A, uint32_t lda,
+                             const float *B, uint32_t ldb,
+                             float *C, uint32_t ldc,
+                             const float *bias, Activation act) {
+  float acc[NOODLE_GEMM_MR][NOODLE_GEMM_NR];
+  for (uint16_t r = 0; r < NOODLE_GEMM_MR; r++)
+    for (uint16_t c = 0; c < NOODLE_GEMM_NR; c++)
+      acc[r][c] = (k0 > 0 && r < mr && c < nr) ? C[(uint32_t)r * ldc + c] : 0.0f;
+
+  if (mr == NOODLE_GEMM_MR && nr == NOODLE_GEMM_NR) {
+    for (uint32_t k = k0; k < k1; k++) {
+      const float *b = B + k * ldb;
+      for (uint16_t r = 0; r < NOODLE_GEMM_MR; r++) {
+        const float a = A[(uint32_t)r * lda + k];
+        for (uint16_t c = 0; c < NOODLE_GEMM_NR; c++) acc[r][c] += a * b[c];
+      }
+    }
+  } else {
+    for (uint32_t k = k0; k < k1; k++) {
+      const float *b = B + k * ldb;
+      for (uint16_t r = 0; r < mr; r++) {
+        const float a = A[(uint32_t)r * lda + k];
+        for (uint16_t c = 0; c < nr; c++) acc[r][c] += a * b[c];
+      }
+    }
+  }
+
+  for (uint16_t r = 0; r < mr; r++) {
+    float *c_row = C + (uint32_t)r * ldc;
+    const float bv = (last && bias) ? bias[r] : 0.0f;
+    for (uint16_t c = 0; c < nr; c++) {
+      float v = acc[r][c];
+      if (last) {
+        v += bv;
+        if ((act == ACT_RELU) && (v < 0.0f)) v = 0.0f;
+      }
+      c_row[c] = v;
+    }
+  }
+}
+
+void noodle_sgemm(uint16_t M, uint32_t N, uint32_t K,
+                  const float *A, uint32_t lda,
+                  const float *B, uint32_t ldb,
+                  float *C, uint32_t ldc,
+                  const float *bias, Activation act) {
+  if (K == 0) {
+    for (uint16_t i = 0; i < M; i++) {
+      float v = bias ? bias[i] : 0.0f;
       if ((act == ACT_RELU) && (v < 0.0f)) v = 0.0f;
-      row[j] = v;
+      for (uint32_t j = 0; j < N; j++) C[(uint32_t)i * ldc + j] = v;
+    }
+    return;
+  }
+
+  for (uint32_t j0 = 0; j0 < N; j0 += NOODLE_GEMM_NC) {
+    const uint32_t nc = (N - j0 < NOODLE_GEMM_NC) ? (N - j0) : NOODLE_GEMM_NC;
+    for (uint32_t k0 = 0; k0 < K; k0 += NOODLE_GEMM_KC) {
+      const uint32_t k1 = (K - k0 < NOODLE_GEMM_KC) ? K : k0 + NOODLE_GEMM_KC;
+      const bool last = (k1 == K);
+      for (uint16_t i = 0; i < M; i += NOODLE_GEMM_MR) {
+        const uint16_t mr = (M - i < NOODLE_GEMM_MR) ? (uint16_t)(M - i) : (uint16_t)NOODLE_GEMM_MR;
+        for (uint32_t j = j0; j < j0 + nc; j += NOODLE_GEMM_NR) {
+          const uint16_t nr = (j0 + nc - j < NOODLE_GEMM_NR) ? (uint16_t)(j0 + nc - j) : (uint16_t)NOODLE_GEMM_NR;
+          noodle_gemm_tile(mr, nr, k0, k1, last,
+                           A + (uint32_t)i * lda, lda,
+                           B + j, ldb,
+                           C + (uint32_t)i * ldc + j, ldc,
+                           bias ? bias + i : nullptr, act);
+        }
+      }
+    }
+  }
+}
+
+// One transpose-convolution output pixel gathered from its phase sub-kernel.
+// Row t of the flipped sub-kernel starts at k + t * ks_row and steps by
+// ks_col; input row iy0 + t, column ix0 + u pairs with tap (t, u). CLIP drops
+// taps that fall outside the input plane.
+template <uint16_t KY, uint16_t KX, bool CLIP>
+static inline float noodle_convt_px(const float *input, uint16_t W,
+                                    const float *k, int32_t ks_row, int32_t ks_col,
+                                    uint16_t Ky, uint16_t Kx,
+                                    int32_t iy0, int32_t ix0, float s) {
+  if (KY) Ky = KY;
+  if (KX) Kx = KX;
+  int32_t t0 = 0, u0 = 0, t1 = Ky, u1 = Kx;
+  if (CLIP) {
+    if (iy0 < 0) t0 = -iy0;
+    if (ix0 < 0) u0 = -ix0;
+    if ((int32_t)W - iy0 < t1) t1 = (int32_t)W - iy0;
+    if ((int32_t)W - ix0 < u1) u1 = (int32_t)W - ix0;
+  }
+  for (int32_t t = t0; t < t1; t++) {
+    const float *row = input + (iy0 + t) * (int32_t)W + ix0;
+    const float *kr = k + t * ks_row;
+    for (int32_t u = u0; u < u1; u++) s += row[u] * kr[u * ks_col];
+  }
+  return s;
+}
+
+// Interior run of n phase pixels, four at a time: the four sums are
+// independent, so their adds overlap instead of forming one long dependency
+// chain, and each pixel still sums its taps in (t, u) order. @p x is the
+// input window of the first pixel; outputs are S floats apart.
+template <uint16_t KY, uint16_t KX>
+static void noodle_convt_run(const float *x, uint16_t W,
+                             const float *k, int32_t ks_row, int32_t ks_col,
+                             uint16_t Ky, uint16_t Kx,
+                             float *out, uint16_t S, uint16_t n, bool accumulate) {
+  if (KY) Ky = KY;
+  if (KX) Kx = KX;
+  uint16_t j = 0;
+  for (; j + 4 <= n; j += 4) {
+    float *o = out + (uint32_t)j * S;
+    float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+    if (accumulate) {
+      s0 = o[0];
+      s1 = o[S];
+      s2 = o[2 * S];
+      s3 = o[3 * S];
+    }
+    for (uint16_t t = 0; t < Ky; t++) {
+      const float *row = x + (uint32_t)t * W + j;
+      const float *kr = k + (int32_t)t * ks_row;
+      for (uint16_t u = 0; u < Kx; u++) {
+        const float w = kr[(int32_t)u * ks_col];
+        s0 += row[u] * w;
+        s1 += row[u + 1] * w;
+        s2 += row[u + 2] * w;
+        s3 += row[u + 3] * w;
+      }
+    }
+    o[0] = s0;
+    o[S] = s1;
+    o[2 * S] = s2;
+    o[3 * S] = s3;
+  }
+  for (; j < n; j++) {
+    float *o = out + (uint32_t)j * S;
+    *o = noodle_convt_px<KY, KX, false>(x + j, W, k, ks_row, ks_col, Ky, Kx, 0, 0,
+                                        accumulate ? *o : 0.0f);
+  }
+}
+
+// Output pixel (oy, ox) with (oy + P0) % S == py and (ox + P0) % S == px only
+// sees kernel taps k[py + S*j][px + S*i], read from input row q - j and
+// column r - i, where q = (oy + P0) / S and r = (ox + P0) / S. Each of the
+// S*S output phases is therefore a dense stride-1 correlation with a flipped
+// Ky x Kx sub-kernel, and the phases write disjoint pixels. Taps are visited
+// in ascending input row/column order, which is the order the scatter form
+// added them in. KY/KX fix the sub-kernel size at compile time so interior
+// pixels unroll; 0 takes them from the runtime arguments.
+template <uint16_t KY, uint16_t KX>
+static void noodle_convt_phase(const float *input, const float *kernel,
+                               uint16_t K, uint16_t W, float *output,
+                               uint16_t Vt, uint16_t S, uint16_t P0,
+                               uint16_t py, uint16_t px,
+                               uint16_t Ky, uint16_t Kx, bool accumulate) {
+  if (KY) Ky = KY;
+  if (KX) Kx = KX;
+  const uint16_t oy0 = (uint16_t)((py + S - P0 % S) % S);
+  const uint16_t ox0 = (uint16_t)((px + S - P0 % S) % S);
+  if (ox0 >= Vt) return;
+
+  // Flipped sub-kernel: tap (t, u) is k[py + S*(Ky-1-t)][px + S*(Kx-1-u)].
+  float sk[(KY && KX) ? KY * KX : 1];
+  const float *sub = kernel;
+  int32_t ks_row = 0, ks_col = 0;
+  if (KY && KX) {
+    for (uint16_t t = 0; t < KY; t++)
+      for (uint16_t u = 0; u < KX; u++)
+        sk[t * KX + u] = kernel[(uint32_t)(py + S * (KY - 1 - t)) * K + px + S * (KX - 1 - u)];
+    sub = sk;
+    ks_row = KX;
+    ks_col = 1;
+  } else if (Ky && Kx) {
+    sub = kernel + (uint32_t)(py + S * (Ky - 1)) * K + px + S * (Kx - 1);
+    ks_row = -(int32_t)S * K;
+    ks_col = -(int32_t)S;
+  }
+
+  // Phase column n is output column ox0 + n*S and reads input columns from
+  // r0 + n - Kx + 1; columns n_lo..n_hi-1 need no clipping.
+  const uint16_t Nx = (uint16_t)((Vt - 1 - ox0) / S + 1);
+  const int32_t r0 = (int32_t)((ox0 + P0) / S);
+  int32_t n_lo = (int32_t)Kx - 1 - r0;
+  int32_t n_hi = (int32_t)W - r0;
+  if (n_lo < 0) n_lo = 0;
+  if (n_hi > (int32_t)Nx) n_hi = Nx;
+
+  for (uint16_t oy = oy0; oy < Vt; oy += S) {
+    float *out = output + (uint32_t)oy * Vt + ox0;
+    const int32_t iy0 = (int32_t)((oy + P0) / S) - Ky + 1;
+    const bool row_in = (iy0 >= 0 && iy0 + Ky <= (int32_t)W);
+
+    const int32_t lo = row_in ? n_lo : (int32_t)Nx;
+    const int32_t hi = row_in ? n_hi : (int32_t)Nx;
+    for (int32_t n = 0; n < (int32_t)Nx; n++) {
+      if (n == lo && lo < hi) {
+        noodle_convt_run<KY, KX>(input + iy0 * (int32_t)W + (r0 + lo - Kx + 1), W,
+                                 sub, ks_row, ks_col, Ky, Kx,
+                                 out + (uint32_t)lo * S, S, (uint16_t)(hi - lo), accumulate);
+        n = hi - 1;
+        continue;
+      }
+      float *o = out + (uint32_t)n * S;
+      *o = noodle_convt_px<KY, KX, true>(input, W, sub, ks_row, ks_col, Ky, Kx,
+                                          iy0, r0 + n - Kx + 1, accumulate ? *o : 0.0f);
     }
   }
-  return n;
 }
 
 uint16_t noodle_do_conv_transpose(float *input,
@@ -433,33 +1096,32 @@ uint16_t noodle_do_conv_transpose(float *input,
                                   float *output,
                                   uint16_t P,
                                   uint16_t S,
-                                  uint16_t OP) {
+                                  uint16_t OP,
+                                  bool accumulate) {
   uint16_t P0, P1;
   const uint16_t Vt = noodle_compute_Vt_and_P(K, W, P, S, OP, P0, P1);
 
-  if (Vt == 0) return 0;
-
-  // Scatter each input pixel through the KxK kernel into the expanded output.
-  for (uint16_t iy = 0; iy < W; iy++) {
-    for (uint16_t ix = 0; ix < W; ix++) {
-      const float x = input[(uint32_t)iy * W + ix];
-      if (x == 0.0f) continue;
-
-      const int32_t base_y = (int32_t)iy * (int32_t)S - (int32_t)P0;
-      const int32_t base_x = (int32_t)ix * (int32_t)S - (int32_t)P0;
-
-      for (uint16_t ky = 0; ky < K; ky++) {
-        const int32_t oy = base_y + ky;
-        if ((uint32_t)oy >= (uint32_t)Vt) continue;
-
-        for (uint16_t kx = 0; kx < K; kx++) {
-          const int32_t ox = base_x + kx;
-          if ((uint32_t)ox >= (uint32_t)Vt) continue;
-
-          output[(uint32_t)oy * Vt + ox] +=
-              x * kernel[(uint32_t)ky * K + kx];
-        }
+  if (Vt == 0 || S == 0) return 0;
+
+  for (uint16_t py = 0; py < S; py++) {
+    const uint16_t Ky = (py < K) ? (uint16_t)((K - py + S - 1) / S) : 0;
+    for (uint16_t px = 0; px < S; px++) {
+      const uint16_t Kx = (px < K) ? (uint16_t)((K - px + S - 1) / S) : 0;
+#if NOODLE_CONV_SPECIALIZE
+      // Sub-kernel sizes of K <= 3 at stride 1 and K <= 6 at stride 2.
+      switch (Ky * 4 + Kx) {
+#define NOODLE_CONVT_CASE(A, B) \
+        case A * 4 + B: \
+          noodle_convt_phase<A, B>(input, kernel, K, W, output, Vt, S, P0, py, px, Ky, Kx, accumulate); \
+          continue;
+        NOODLE_CONVT_CASE(1, 1) NOODLE_CONVT_CASE(1, 2) NOODLE_CONVT_CASE(1, 3)
+        NOODLE_CONVT_CASE(2, 1) NOODLE_CONVT_CASE(2, 2) NOODLE_CONVT_CASE(2, 3)
+        NOODLE_CONVT_CASE(3, 1) NOODLE_CONVT_CASE(3, 2) NOODLE_CONVT_CASE(3, 3)
+#undef NOODLE_CONVT_CASE
+        default: break;
       }
+#endif
+      noodle_convt_phase<0, 0>(input, kernel, K, W, output, Vt, S, P0, py, px, Ky, Kx, accumulate);
     }
   }
 
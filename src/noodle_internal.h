@@ -41,6 +41,10 @@ extern NDL_File fi;
 extern void *temp_buff1;
 /** @brief Global accumulation scratch buffer, either Noodle-owned or caller-owned. */
 extern void *temp_buff2;
+/** @brief Noodle-owned workspace for blocked convolution passes. */
+extern void *temp_buff3;
+/** @brief RAM budget in bytes for blocked file-input convolution. */
+extern size_t conv_budget;
 
 /**
  * @brief Ensure temp buffer 1 can hold a number of floats.
@@ -66,12 +70,40 @@ float *noodle_temp1_require(size_t required_floats);
  */
 float *noodle_temp2_require(size_t required_floats);
 
+/**
+ * @brief Ensure temp buffer 3 can hold a number of floats.
+ * @ingroup noodle_internal
+ *
+ * Temp buffer 3 is always Noodle-owned and holds the multi-channel workspace
+ * of blocked convolution passes. It grows when needed.
+ *
+ * @param required_floats Required capacity in float elements.
+ * @return Usable float pointer, or NULL on allocation failure/zero request.
+ */
+float *noodle_temp3_require(size_t required_floats);
+
+/**
+ * @brief Allocate a float array, preferring internal RAM over PSRAM.
+ * @ingroup noodle_internal
+ * @param required_floats Number of float elements.
+ * @return Pointer to release with free(), or NULL on failure/zero request.
+ */
+float *noodle_alloc_temp_float(size_t required_floats);
+
 /**
  * @brief Free Noodle-owned scratch buffers and detach external scratch buffers.
  * @ingroup noodle_internal
  */
 void noodle_temp_buffers_free(void);
 
+/**
+ * @brief Free the scratch of the blocked and GEMM Conv1D kernels.
+ * @ingroup noodle_internal
+ *
+ * Called by noodle_temp_buffers_free().
+ */
+void noodle_conv1d_scratch_free(void);
+
 /**
  * @brief Return a channel plane from a packed `[Z][W][W]` tensor.
  * @ingroup noodle_internal
@@ -82,6 +114,34 @@ void noodle_temp_buffers_free(void);
  */
 float *noodle_slice(float *flat, size_t W, size_t z);
 
+/**
+ * @brief Check a weight or bias file out of the read-handle cache.
+ * @ingroup noodle_internal
+ *
+ * A cached handle is rewound and returned without reopening the file. On a
+ * miss the file is opened and replaces the least recently used idle slot.
+ * Paths longer than `NOODLE_MAX_FILENAME`, nested checkouts of the same path,
+ * and a cache with every slot checked out fall back to a plain open. With
+ * `NOODLE_FS_CACHE` set to 0 this is noodle_fs_open_read().
+ *
+ * @param path Filename or path.
+ * @return Handle positioned at byte 0, or an invalid handle on failure.
+ */
+NDL_File noodle_fs_open_cached(const char *path);
+
+/**
+ * @brief Return a handle obtained from noodle_fs_open_cached().
+ * @ingroup noodle_internal
+ *
+ * The cached handle stays open for the next checkout; any other handle is
+ * closed. @p f is invalid afterwards either way. Nested checkouts of one path
+ * must be released in reverse order.
+ *
+ * @param f Handle to release; invalid handles are ignored.
+ * @param path Path passed to noodle_fs_open_cached().
+ */
+void noodle_fs_release(NDL_File &f, const char *path);
+
 /**
  * @brief Read raw bytes from a backend file handle.
  * @ingroup noodle_internal
@@ -106,8 +166,9 @@ size_t noodle_write_raw(NDL_File &f, const void *src, size_t n);
  * @brief Read a block of floats using the configured scalar file format.
  * @ingroup noodle_internal
  *
- * In binary mode this reads raw float32 bytes. In text mode it calls
- * noodle_read_float() once per value.
+ * In binary mode this reads raw float32 bytes in one call. In text mode it
+ * reads `NOODLE_IO_CHUNK` characters at a time, parses complete lines, and
+ * seeks back over any partial line so the file position stays exact.
  *
  * @param f Open input file.
  * @param dst Destination float buffer.
@@ -116,6 +177,105 @@ size_t noodle_write_raw(NDL_File &f, const void *src, size_t n);
  */
 size_t noodle_read_float_block(NDL_File &f, float *dst, size_t n_floats);
 
+/**
+ * @brief Sequential block reader over a float file with optional prefetch.
+ * @ingroup noodle_internal
+ *
+ * A stream hands out fixed-size float blocks in file order. The file is split
+ * into cycles of `cycle_floats` values; the last block of a cycle may be
+ * shorter. With `rewind` set, the file goes back to the starting position at
+ * every cycle boundary, which is how file-input layers re-read their input per
+ * output channel. Fill it with noodle_stream_begin(); fields are private.
+ */
+struct NoodleStream {
+  NDL_File *f;
+  float *buf;               ///< Caller block buffer used by synchronous reads.
+  uint32_t block_floats;
+  uint32_t cycle_floats;
+  uint32_t blocks_per_cycle;
+  uint32_t total_blocks;
+  uint32_t next_block;
+  uint32_t start_pos;
+  bool rewind;
+  void *async;              ///< Reader thread state when prefetching.
+};
+
+/**
+ * @brief Start a block stream on an open file.
+ * @ingroup noodle_internal
+ *
+ * Without `NOODLE_PREFETCH`, or when the reader cannot be started, blocks are
+ * read synchronously into @p buf. With prefetch, a reader fills a ring of
+ * @p depth heap slots ahead of the consumer.
+ *
+ * @param st Stream state to initialize.
+ * @param f Open input file positioned at the first block.
+ * @param buf Caller buffer with room for @p block_floats values.
+ * @param block_floats Floats per block.
+ * @param cycle_floats Floats per cycle; a multiple of blocks plus a tail.
+ * @param cycles Number of cycles to deliver.
+ * @param rewind Seek back to the start position at every cycle boundary.
+ * @param depth Ring slots to use when prefetching.
+ */
+void noodle_stream_begin(NoodleStream *st, NDL_File &f, float *buf,
+                         uint32_t block_floats, uint32_t cycle_floats,
+                         uint16_t cycles, bool rewind, uint16_t depth);
+
+/**
+ * @brief Return the next block of a stream.
+ * @ingroup noodle_internal
+ *
+ * The returned block stays valid, and may be modified in place, until the
+ * next call. Values past the end of the file are zero-filled.
+ *
+ * @param st Stream started with noodle_stream_begin().
+ * @param n Optional; receives the number of floats actually read.
+ * @return Block pointer, or NULL once every block has been delivered.
+ */
+float *noodle_stream_next(NoodleStream *st, uint32_t *n);
+
+/**
+ * @brief Stop a stream's reader and release its ring.
+ * @ingroup noodle_internal
+ *
+ * Call before closing the stream's file.
+ *
+ * @param st Stream started with noodle_stream_begin().
+ */
+void noodle_stream_end(NoodleStream *st);
+
+/**
+ * @brief Append one float to the write-behind buffer of an output file.
+ * @ingroup noodle_internal
+ *
+ * In binary mode values are coalesced into `NOODLE_WRITE_BUFFER`-byte blocks
+ * before noodle_write_raw() is called. The buffer is bound to one handle at a
+ * time; writing to a different handle flushes the previous one first. Text
+ * mode, and `NOODLE_WRITE_BUFFER == 0`, fall through to noodle_write_float().
+ *
+ * @param fo Open output file. Must stay valid until noodle_out_flush().
+ * @param v Value to write.
+ */
+void noodle_out_float(NDL_File &fo, float v);
+
+/**
+ * @brief Write out everything buffered for an output file.
+ * @ingroup noodle_internal
+ *
+ * Also waits for the background writer when `NOODLE_WRITE_THREAD` is enabled,
+ * so the file is complete when this returns.
+ *
+ * @param fo Output file previously passed to noodle_out_float().
+ */
+void noodle_out_flush(NDL_File &fo);
+
+/**
+ * @brief Flush buffered output for a file, then close it.
+ * @ingroup noodle_internal
+ * @param fo Output file handle.
+ */
+void noodle_out_close(NDL_File &fo);
+
 /**
  * @brief Compute a dot product with a small unrolled loop.
  * @ingroup noodle_internal
@@ -143,11 +303,34 @@ float noodle_dot_float_block(const float *x, const float *w, uint16_t n);
  * @param output Accumulator receiving `V` values.
  * @param P Zero padding per side.
  * @param S Stride.
- * @return Output length before pooling.
+ * @return Output length before pooling, or 0 when the kernel is longer than
+ *         the padded sequence.
  */
 uint16_t noodle_do_conv1d(float *input, float *kernel, uint16_t W, uint16_t K,
                           float *output, uint16_t P, uint16_t S);
 
+/**
+ * @brief Accumulate one input sequence into a block of output channels.
+ * @ingroup noodle_internal
+ *
+ * Like noodle_do_conv1d() for `NOODLE_CONV_OBLOCK` output channels at once.
+ * The kernels are packed `[K][B]` and the accumulator is sample-major
+ * `[V][B]`, so each input value is loaded once per block. Per channel the
+ * result is bit-identical to noodle_do_conv1d(). Only built when
+ * `NOODLE_CONV_OBLOCK > 1`.
+ *
+ * @param input Input sequence with @p W values.
+ * @param wp Packed kernels of the block.
+ * @param K Kernel length.
+ * @param W Input sequence length.
+ * @param acc Sample-major accumulator.
+ * @param P Zero padding per side.
+ * @param S Stride.
+ * @return Output length before pooling.
+ */
+uint16_t noodle_do_conv1d_block(const float *input, const float *wp, uint16_t K,
+                                uint16_t W, float *acc, uint16_t P, uint16_t S);
+
 /**
  * @brief Apply valid 1D max pooling and write to a file.
  * @ingroup noodle_internal
@@ -278,7 +461,13 @@ uint16_t noodle_do_pooling(const float *input, uint16_t W, uint16_t K,
  * @ingroup noodle_internal
  *
  * The input plane is `[W][W]`; the kernel is `[K][K]`; output is accumulated in
- * `[V][V]` order instead of cleared.
+ * `[V][V]` order instead of cleared. Outputs whose window lies inside the
+ * plane run without bounds checks; border outputs clip the window to the
+ * plane, honoring asymmetric SAME padding.
+ *
+ * With `NOODLE_CONV_SPECIALIZE`, `K` in {1, 3, 5} and `S` in {1, 2} dispatch
+ * to compile-time instances that unroll the taps over strips of output
+ * columns; other shapes use the generic loop. Results are bit-identical.
  *
  * @param grid Input plane.
  * @param kernel Kernel values.
@@ -297,7 +486,8 @@ uint16_t noodle_do_conv(byte *grid, const float *kernel, uint16_t K,
  * @ingroup noodle_internal
  *
  * The input plane is `[W][W]`; the kernel is `[K][K]`; output is accumulated in
- * `[V][V]` order instead of cleared.
+ * `[V][V]` order instead of cleared. Uses the same interior/border split as
+ * the byte overload.
  *
  * @param grid Input plane.
  * @param kernel Kernel values.
@@ -311,6 +501,148 @@ uint16_t noodle_do_conv(byte *grid, const float *kernel, uint16_t K,
 uint16_t noodle_do_conv(float *grid, const float *kernel, uint16_t K,
                         uint16_t W, float *output, uint16_t P, uint16_t S);
 
+/**
+ * @brief Accumulate output rows `r0..r1-1` of one float-input 2D convolution.
+ * @ingroup noodle_internal
+ *
+ * Same kernels and per-pixel summation order as noodle_do_conv(), restricted
+ * to a band of output rows so callers can keep only the rows a pooling window
+ * needs. @p output holds `(r1 - r0) * V` values with row @p r0 first; @p r1
+ * is clipped to `V`.
+ *
+ * @param grid Input plane.
+ * @param kernel Kernel values.
+ * @param K Kernel width.
+ * @param W Input width and height.
+ * @param output Band accumulator.
+ * @param P Padding per side, or `65535` for SAME-style padding.
+ * @param S Stride.
+ * @param r0 First output row.
+ * @param r1 One past the last output row.
+ * @return Output width before pooling.
+ */
+uint16_t noodle_do_conv_rows(const float *grid, const float *kernel, uint16_t K,
+                             uint16_t W, float *output, uint16_t P, uint16_t S,
+                             uint16_t r0, uint16_t r1);
+
+/** @brief ReLU mode for noodle_simd_affine(): none. */
+#define NOODLE_RELU_NONE 0
+/** @brief ReLU mode for noodle_simd_affine(): `v < 0 ? 0 : v`, as in noodle_do_bias_act(). */
+#define NOODLE_RELU_NEG  1
+/** @brief ReLU mode for noodle_simd_affine(): `v > 0 ? v : 0`, as in noodle_bn2d_relu(). */
+#define NOODLE_RELU_POS  2
+
+/**
+ * @brief Vectorized dot product.
+ * @ingroup noodle_internal
+ * @param x First operand.
+ * @param w Second operand.
+ * @param n Number of elements.
+ * @param sum Receives the result.
+ * @return false when the scalar path is selected; @p sum is then untouched.
+ */
+bool noodle_simd_dot(const float *x, const float *w, uint32_t n, float &sum);
+
+/**
+ * @brief Vectorized in-place `x = relu(s * x + t)`.
+ * @ingroup noodle_internal
+ * @param x Values to update.
+ * @param n Number of elements.
+ * @param s Scale.
+ * @param t Shift.
+ * @param relu One of the `NOODLE_RELU_*` modes.
+ * @return false when the scalar path is selected.
+ */
+bool noodle_simd_affine(float *x, uint32_t n, float s, float t, uint8_t relu);
+
+/**
+ * @brief Vectorized 2x2 stride-2 pooling of one `[W][W]` plane.
+ * @ingroup noodle_internal
+ * @param in Input plane.
+ * @param W Input width and height.
+ * @param out Output plane of width `W / 2`.
+ * @return false when the scalar path is selected.
+ */
+bool noodle_simd_pool2(const float *in, uint16_t W, float *out);
+
+/**
+ * @brief Vectorized interior convolution row for stride 1 or 2.
+ * @ingroup noodle_internal
+ *
+ * Sums the `K * K` taps from zero for consecutive outputs and adds them to
+ * @p out, like the scalar strip kernel.
+ *
+ * @param x Top-left input of the first output's window.
+ * @param kernel `[K][K]` kernel.
+ * @param K Kernel width.
+ * @param W Input row pitch.
+ * @param S Stride.
+ * @param out Output accumulators.
+ * @param n Number of outputs in the row.
+ * @return Leading outputs done; the caller computes the remainder.
+ */
+uint16_t noodle_simd_conv_row(const float *x, const float *kernel, uint16_t K,
+                              uint16_t W, uint16_t S, float *out, uint16_t n);
+
+/**
+ * @brief Vectorized interior row of noodle_do_conv_block() for blocks of 8.
+ * @ingroup noodle_internal
+ * @param x Top-left input of the first output's window.
+ * @param wp Packed `[K][K][8]` kernels.
+ * @param K Kernel width.
+ * @param W Input row pitch.
+ * @param S Stride.
+ * @param acc Pixel-major accumulators of the first output.
+ * @param n Number of outputs in the row.
+ * @return Leading outputs done; the caller computes the remainder.
+ */
+uint16_t noodle_simd_conv_block_row(const float *x, const float *wp, uint16_t K,
+                                    uint16_t W, uint16_t S, float *acc, uint16_t n);
+
+/**
+ * @brief Accumulate one input plane into a block of output channels.
+ * @ingroup noodle_internal
+ *
+ * Like noodle_do_conv() for `NOODLE_CONV_OBLOCK` output channels at once.
+ * The kernels are packed `[K][K][B]` and the accumulator is pixel-major
+ * `[V][V][B]`, so each input value is loaded once per block. Per channel
+ * the result is bit-identical to noodle_do_conv(). Only built when
+ * `NOODLE_CONV_OBLOCK > 1`.
+ *
+ * @param grid Input plane.
+ * @param wp Packed kernels of the block.
+ * @param K Kernel width.
+ * @param W Input width and height.
+ * @param acc Pixel-major accumulator.
+ * @param P Padding per side, or `65535` for SAME-style padding.
+ * @param S Stride.
+ * @return Output width before pooling.
+ */
+uint16_t noodle_do_conv_block(const float *grid, const float *wp, uint16_t K,
+                              uint16_t W, float *acc, uint16_t P, uint16_t S);
+
+/**
+ * @brief Band form of noodle_do_conv_block() for output rows `r0..r1-1`.
+ * @ingroup noodle_internal
+ *
+ * @p acc holds `(r1 - r0) * V * B` values with row @p r0 first; @p r1 is
+ * clipped to `V`.
+ *
+ * @param grid Input plane.
+ * @param wp Packed kernels of the block.
+ * @param K Kernel width.
+ * @param W Input width and height.
+ * @param acc Pixel-major band accumulator.
+ * @param P Padding per side, or `65535` for SAME-style padding.
+ * @param S Stride.
+ * @param r0 First output row.
+ * @param r1 One past the last output row.
+ * @return Output width before pooling.
+ */
+uint16_t noodle_do_conv_block_rows(const float *grid, const float *wp, uint16_t K,
+                                   uint16_t W, float *acc, uint16_t P, uint16_t S,
+                                   uint16_t r0, uint16_t r1);
+
 /**
  * @brief Clear a float buffer.
  * @ingroup noodle_internal
@@ -319,6 +651,34 @@ uint16_t noodle_do_conv(float *grid, const float *kernel, uint16_t K,
  */
 void noodle_reset_buffer(float *buffer, uint16_t n);
 
+/**
+ * @brief Cache-blocked single-precision matrix multiply with bias/activation.
+ * @ingroup noodle_internal
+ *
+ * Computes `C = act(A * B + bias)` for row-major `A [M][K]`, `B [K][N]` and
+ * `C [M][N]`, using a 4 x 8 register tile and 128 x 64 cache blocks. Each
+ * element sums its products in `k` order before the bias is added, so the
+ * result matches a direct per-channel accumulation. ACT_RELU clamps to zero;
+ * other activations leave the biased sum unchanged.
+ *
+ * @param M Rows of A and C.
+ * @param N Columns of B and C.
+ * @param K Columns of A and rows of B.
+ * @param A Left matrix.
+ * @param lda Row stride of A in floats.
+ * @param B Right matrix.
+ * @param ldb Row stride of B in floats.
+ * @param C Output matrix; fully overwritten.
+ * @param ldc Row stride of C in floats.
+ * @param bias Per-row bias of length @p M, or nullptr.
+ * @param act Activation applied after the bias.
+ */
+void noodle_sgemm(uint16_t M, uint32_t N, uint32_t K,
+                  const float *A, uint32_t lda,
+                  const float *B, uint32_t ldb,
+                  float *C, uint32_t ldc,
+                  const float *bias, Activation act);
+
 /**
  * @brief Add bias to a square output map and apply the requested activation.
  * @ingroup noodle_internal
@@ -334,12 +694,63 @@ void noodle_reset_buffer(float *buffer, uint16_t n);
  */
 uint16_t noodle_do_bias_act(float *output, float bias, uint16_t n, Activation act);
 
+/**
+ * @brief Bias, activate and pool one output row from `M` accumulator rows.
+ * @ingroup noodle_internal
+ *
+ * Reads `M` rows of @p V sums spaced @p step floats apart (1 for a plane,
+ * `NOODLE_CONV_OBLOCK` for a pixel-major block) and writes one pooled row.
+ * Max pooling takes the window maximum of the raw sums and then adds the
+ * bias and applies the activation, which is exact because both are
+ * monotone. Mean pooling activates each value first. Identity pooling
+ * (`M == T == 1`, or `NOODLE_POOL_NONE`) writes @p V activated values.
+ * Results match noodle_do_bias_act() followed by noodle_do_pooling().
+ *
+ * @param acc First accumulator of the window rows.
+ * @param V Accumulator row width.
+ * @param step Distance between neighbouring sums in floats.
+ * @param M Pool window size.
+ * @param T Pool stride.
+ * @param bias Bias scalar.
+ * @param act Activation to apply.
+ * @param out Destination row.
+ * @return Pooled row width, or 0 for invalid pooling parameters.
+ */
+uint16_t noodle_pool_bias_act_row(const float *acc, uint16_t V, uint8_t step,
+                                  uint16_t M, uint16_t T, float bias,
+                                  Activation act, float *out);
+
+/**
+ * @brief Bias, activate and pool a `[V][V]` plane in one step.
+ * @ingroup noodle_internal
+ *
+ * Replaces noodle_do_bias_act() followed by noodle_do_pooling() with the
+ * same results. Identity pooling writes the activated values straight to
+ * @p output (in place when it is @p plane); max pooling pools first and
+ * activates the smaller map; mean pooling runs as one pass per output row.
+ * @p output must not overlap @p plane when pooling.
+ *
+ * @param plane Accumulated convolution plane.
+ * @param bias Bias scalar.
+ * @param V Plane width and height.
+ * @param act Activation to apply.
+ * @param M Pool window size.
+ * @param T Pool stride.
+ * @param output Destination map.
+ * @return Output width, or 0 for invalid pooling parameters.
+ */
+uint16_t noodle_do_bias_act_pool(float *plane, float bias, uint16_t V,
+                                 Activation act, uint16_t M, uint16_t T,
+                                 float *output);
+
 /**
  * @brief Accumulate one 2D transpose-convolution plane.
  * @ingroup noodle_internal
  *
  * The input plane is `[W][W]`; the kernel is `[K][K]`; output is accumulated in
- * `[Vt][Vt]` order instead of cleared.
+ * `[Vt][Vt]` order instead of cleared, or overwritten when @p accumulate is
+ * false. Each output pixel gathers its taps from one of `S * S` stride phases,
+ * so every pixel is written exactly once and no zero-fill is needed.
  *
  * For explicit padding, callers choose @p OP so
  * `Vt = (W - 1) * S - 2 * P + K + OP` matches the desired output width.
@@ -353,11 +764,12 @@ uint16_t noodle_do_bias_act(float *output, float bias, uint16_t n, Activation ac
  * @param P Padding per side, or `65535` for SAME-style padding.
  * @param S Stride.
  * @param OP User-computed output padding for explicit padding.
+ * @param accumulate Add to @p output when true, overwrite it when false.
  * @return Output width.
  */
 uint16_t noodle_do_conv_transpose(float *input, const float *kernel, uint16_t K,
                                   uint16_t W, float *output, uint16_t P,
-                                  uint16_t S, uint16_t OP);
+                                  uint16_t S, uint16_t OP, bool accumulate = true);
 
 /**
  * @brief Find the maximum value and its index in a vector.
@@ -698,6 +1110,15 @@ uint16_t noodle_conv_float(float *input, uint16_t n_inputs,
                            uint16_t W, const ConvProgmem &conv,
                            const Pool &pool, CBFPtr progress_cb);
 
+/**
+ * @brief Raw memory-to-memory 2D convolution with `.ndl` container parameters.
+ * @ingroup noodle_internal
+ */
+uint16_t noodle_conv_float(float *input, uint16_t n_inputs,
+                           uint16_t n_outputs, float *output,
+                           uint16_t W, const ConvPacked &conv,
+                           const Pool &pool, CBFPtr progress_cb);
+
 /**
  * @brief Raw memory-to-memory 2D transpose convolution.
  * @ingroup noodle_internal
@@ -751,6 +1172,30 @@ uint16_t noodle_dwconv_float(float *input, uint16_t n_channels,
                              const ConvProgmem &conv, const Pool &pool,
                              CBFPtr progress_cb);
 
+/**
+ * @brief Raw memory-to-memory depthwise convolution with `.ndl` container parameters.
+ * @ingroup noodle_internal
+ */
+uint16_t noodle_dwconv_float(float *input, uint16_t n_channels,
+                             float *output, uint16_t W,
+                             const ConvPacked &conv, const Pool &pool,
+                             CBFPtr progress_cb);
+
+/**
+ * @brief Raw memory-to-memory depthwise conv fused with the following 1x1 conv.
+ * @ingroup noodle_internal
+ *
+ * Computes `pw(dw(input))` a band of rows at a time, so the `[C][V][V]`
+ * depthwise map is never stored. @p pool applies after the pointwise layer.
+ * Scratch comes from temp_buff3: `C * R * V` floats, where R is the rows
+ * that fit in `NOODLE_DWPW_BUFFER` without pooling, plus `O * M * V` with
+ * pooling (R = M). Returns 0 when @p pw is not 1x1 stride 1 without padding.
+ */
+uint16_t noodle_dwpw_float(float *input, uint16_t n_channels,
+                           uint16_t n_outputs, float *output, uint16_t W,
+                           const ConvMem &dw, const ConvMem &pw,
+                           const Pool &pool, CBFPtr progress_cb);
+
 /**
  * @brief Byte-input fully connected layer with file-backed parameters.
  * @ingroup noodle_internal
@@ -807,6 +1252,14 @@ uint16_t noodle_fcn(const float *input, uint16_t n_inputs,
                     uint16_t n_outputs, float *output,
                     const FCNProgmem &fcn, CBFPtr progress_cb);
 
+/**
+ * @brief Float-input fully connected layer with `.ndl` container parameters.
+ * @ingroup noodle_internal
+ */
+uint16_t noodle_fcn(const float *input, uint16_t n_inputs,
+                    uint16_t n_outputs, float *output,
+                    const FCNPacked &fcn, CBFPtr progress_cb);
+
 /**
  * @brief Float-input fully connected layer with near-PROGMEM parameters.
  * @ingroup noodle_internal
@@ -870,6 +1323,53 @@ void noodle_grid_from_file(NDL_File &fi, float *buffer, uint16_t K);
 void noodle_copy_kernel_progmem(const float *w, uint32_t base,
                                 uint16_t K, float *kernel);
 
+/**
+ * @brief Position a `.ndl` container at element @p index of a float32 payload.
+ * @ingroup noodle_internal
+ * @param model Open container.
+ * @param offset Payload byte offset.
+ * @param index Element index within the payload.
+ * @return true when the seek succeeded.
+ */
+bool noodle_model_seek(NoodleModel &model, uint32_t offset, uint32_t index);
+
+/**
+ * @brief Read raw float32 values at the container's current position.
+ * @ingroup noodle_internal
+ *
+ * Payloads are binary in every `NOODLE_FILE_FORMAT`. Values past the end of
+ * the file read as zero.
+ *
+ * @param model Open container.
+ * @param dst Destination buffer.
+ * @param n Number of floats to read.
+ * @return Number of floats actually read.
+ */
+uint32_t noodle_model_floats(NoodleModel &model, float *dst, uint32_t n);
+
+/**
+ * @brief Read one bias value from a `.ndl` container.
+ * @ingroup noodle_internal
+ * @param model Open container.
+ * @param offset Bias payload byte offset; 0 means zero bias.
+ * @param index Channel index.
+ * @return Bias value, or 0 when @p offset is 0.
+ */
+float noodle_model_bias(NoodleModel &model, uint32_t offset, uint32_t index);
+
+/**
+ * @brief Ask the OS to fault in parameters ahead of a layer.
+ * @ingroup noodle_internal
+ *
+ * Issues `madvise(MADV_WILLNEED)` when @p p lies inside an open
+ * @ref NoodleMap on a host; does nothing for RAM or PROGMEM weights, and on
+ * ESP32 where the flash cache fills on demand.
+ *
+ * @param p First parameter value.
+ * @param n Number of floats the layer will read.
+ */
+void noodle_map_hint(const float *p, size_t n);
+
 
 // ============================================================
 // Raw tensor utilities and activations
@@ -4,6 +4,25 @@
  * @ingroup noodle_api
  */
 #include "noodle_internal.h"
+#include <string.h>
+
+#if NOODLE_WRITE_THREAD
+  #include <pthread.h>
+#endif
+
+#if NOODLE_PREFETCH
+  #include <atomic>
+  #include <new>
+  #if defined(ARDUINO_ARCH_ESP32) || defined(ESP_PLATFORM)
+    #include "freertos/FreeRTOS.h"
+    #include "freertos/task.h"
+    #include "freertos/semphr.h"
+    #define NOODLE_PREFETCH_FREERTOS 1
+  #else
+    #include <pthread.h>
+    #include <sched.h>
+  #endif
+#endif
 
 void noodle_read_top_line(const char* fn, char *line, size_t maxlen) {
   line[0] = '\0'; // empty by default
@@ -90,6 +109,11 @@ bool noodle_fs_init() {
 #if defined(NOODLE_USE_NONE)
   return false;
 
+#elif defined(NOODLE_USE_POSIX) || defined(NOODLE_USE_RAMDISK)
+  // Nothing to mount: stdio resolves paths against the working directory and
+  // the RAM disk is ready as soon as the program starts.
+  return true;
+
 #elif defined(NOODLE_USE_SD_MMC)
   return SD_MMC.begin("/sdcard", false, false, 20000, 5);
 
@@ -118,6 +142,10 @@ bool noodle_fs_init(uint8_t cs_pin) {
   (void)cs_pin;
   return SD_MMC.begin("/sdcard", false, false, 20000, 5);
 
+#elif defined(NOODLE_USE_POSIX) || defined(NOODLE_USE_RAMDISK)
+  (void)cs_pin;
+  return noodle_fs_init();
+
 #else
   // FFat / LittleFS ignore CS
   (void)cs_pin;
@@ -161,19 +189,62 @@ size_t noodle_write_raw(NDL_File &f, const void *src, size_t n) {
 #endif
 }
 
+#if NOODLE_FILE_FORMAT == NOODLE_FILE_FORMAT_TEXT
+// Parse up to n newline-terminated values from NOODLE_IO_CHUNK-byte reads.
+// Bytes past the last complete line are handed back with a seek so the file
+// position matches what per-value noodle_read_float() calls would leave.
+static size_t noodle_read_text_floats(NDL_File &f, float *dst, size_t n) {
+  char chunk[NOODLE_IO_CHUNK + 1];
+  size_t count = 0;
+
+  while (count < n) {
+    const uint32_t start = (uint32_t)f.position();
+    const size_t got = noodle_read_raw(f, chunk, NOODLE_IO_CHUNK);
+    if (got == 0) break;
+    chunk[got] = '\0';
+
+    const bool eof = (got < NOODLE_IO_CHUNK);
+    size_t line = 0;
+    for (size_t i = 0; i < got && count < n; i++) {
+      if (chunk[i] != '\n') continue;
+      chunk[i] = '\0';
+      dst[count++] = atof(chunk + line);
+      line = i + 1;
+    }
+    if (eof && count < n && line < got) {
+      dst[count++] = atof(chunk + line);  // last value without a newline
+      line = got;
+    }
+
+    if (line == 0) {
+      // A single line longer than the chunk: fall back to the scalar parser.
+      noodle_seek_file(f, start);
+      dst[count++] = noodle_read_float(f);
+    } else if (line < got) {
+      noodle_seek_file(f, start + (uint32_t)line);
+    }
+    if (eof) break;
+  }
+  return count;
+}
+#endif
+
 size_t noodle_read_float_block(NDL_File &f, float *dst, size_t n_floats) {
 #if NOODLE_FILE_FORMAT == NOODLE_FILE_FORMAT_BIN
   const size_t want = n_floats * sizeof(float);
   const size_t got = noodle_read_raw(f, dst, want);
   return got / sizeof(float);
 #else
-  for (size_t i = 0; i < n_floats; i++) {
-    dst[i] = noodle_read_float(f);
-  }
-  return n_floats;
+  return noodle_read_text_floats(f, dst, n_floats);
 #endif
 }
 
+// Read n floats into dst, zero-filling anything past the end of the file the
+// same way noodle_read_float() does for a short read.
+static void noodle_read_floats(NDL_File &f, float *dst, uint32_t n) {
+  const size_t got = noodle_read_float_block(f, dst, n);
+  for (uint32_t i = (uint32_t)got; i < n; i++) dst[i] = 0.0f;
+}
 
 float noodle_read_float(NDL_File &f) {
 #if NOODLE_FILE_FORMAT == NOODLE_FILE_FORMAT_BIN
@@ -220,6 +291,475 @@ void noodle_write_byte(NDL_File &f,
 #endif
 }
 
+// ===== Read-handle cache =====
+
+#if NOODLE_FS_CACHE > 0
+struct NoodleFsSlot {
+  char path[NOODLE_MAX_FILENAME + 2];   ///< Normalized path, empty when free.
+  NDL_File f;
+  uint32_t used;                        ///< LRU tick of the last checkout.
+  uint8_t refs;                         ///< Checkouts not yet released.
+};
+
+static NoodleFsSlot noodle_fs_slots[NOODLE_FS_CACHE];
+static uint32_t noodle_fs_tick = 0;
+
+static int noodle_fs_cache_find(const char *path) {
+  for (int s = 0; s < NOODLE_FS_CACHE; s++)
+    if (noodle_fs_slots[s].path[0] && strcmp(noodle_fs_slots[s].path, path) == 0) return s;
+  return -1;
+}
+
+// Forget a slot. A checked-out handle is left to its holder, whose release
+// no longer finds the path and closes it.
+static void noodle_fs_cache_evict(NoodleFsSlot &slot) {
+  if (slot.refs == 0 && slot.f) slot.f.close();
+  slot.f = NDL_File();
+  slot.path[0] = '\0';
+  slot.refs = 0;
+}
+#endif
+
+NDL_File noodle_fs_open_cached(const char *path) {
+#if NOODLE_FS_CACHE > 0
+  const char *key = noodle_norm_filename(path);
+  if (!key || !key[0] || strlen(key) > NOODLE_MAX_FILENAME + 1) return noodle_fs_open_read(path);
+
+  const int hit = noodle_fs_cache_find(key);
+  if (hit >= 0) {
+    NoodleFsSlot &slot = noodle_fs_slots[hit];
+    slot.used = ++noodle_fs_tick;
+    if (slot.refs == 0) {
+      slot.refs = 1;
+      noodle_rewind_file(slot.f);
+      return slot.f;
+    }
+    // Nested checkout of the same path: hand out a private handle.
+    NDL_File f = noodle_fs_open_read(path);
+    if (f) slot.refs++;
+    return f;
+  }
+
+  // Free slot first, otherwise the least recently used idle one.
+  int victim = -1;
+  for (int s = 0; s < NOODLE_FS_CACHE; s++) {
+    const NoodleFsSlot &slot = noodle_fs_slots[s];
+    if (!slot.path[0]) { victim = s; break; }
+    if (slot.refs == 0 && (victim < 0 || slot.used < noodle_fs_slots[victim].used)) victim = s;
+  }
+  if (victim < 0) return noodle_fs_open_read(path);
+
+  char name[NOODLE_MAX_FILENAME + 2];
+  strcpy(name, key);
+  NoodleFsSlot &slot = noodle_fs_slots[victim];
+  noodle_fs_cache_evict(slot);
+
+  NDL_File f = noodle_fs_open_read(path);
+  if (!f) return f;
+  strcpy(slot.path, name);
+  slot.f = f;
+  slot.refs = 1;
+  slot.used = ++noodle_fs_tick;
+  return f;
+#else
+  return noodle_fs_open_read(path);
+#endif
+}
+
+void noodle_fs_release(NDL_File &f, const char *path) {
+  if (!f) return;
+#if NOODLE_FS_CACHE > 0
+  const int s = noodle_fs_cache_find(noodle_norm_filename(path));
+  if (s >= 0 && noodle_fs_slots[s].refs > 0) {
+    NoodleFsSlot &slot = noodle_fs_slots[s];
+    if (--slot.refs > 0) {
+      f.close();        // the most recent nested checkout
+    } else {
+      f = NDL_File();   // the cached handle stays open
+    }
+    return;
+  }
+#else
+  (void)path;
+#endif
+  f.close();
+}
+
+void noodle_fs_cache_drop(const char *path) {
+#if NOODLE_FS_CACHE > 0
+  if (!path) return;
+  const int s = noodle_fs_cache_find(path);
+  if (s >= 0) noodle_fs_cache_evict(noodle_fs_slots[s]);
+#else
+  (void)path;
+#endif
+}
+
+void noodle_fs_cache_clear() {
+#if NOODLE_FS_CACHE > 0
+  for (int s = 0; s < NOODLE_FS_CACHE; s++) noodle_fs_cache_evict(noodle_fs_slots[s]);
+  noodle_fs_tick = 0;
+#endif
+}
+
+// ===== Block streams and prefetch =====
+
+// Length of block b within its cycle; the last block of a cycle may be short.
+static uint32_t noodle_stream_block_len(const NoodleStream *st, uint32_t b) {
+  const uint32_t off = (b % st->blocks_per_cycle) * st->block_floats;
+  const uint32_t left = st->cycle_floats - off;
+  return (left < st->block_floats) ? left : st->block_floats;
+}
+
+// Read block b into dst, seeking back at cycle boundaries when rewinding.
+static uint32_t noodle_stream_read(NoodleStream *st, uint32_t b, float *dst) {
+  if (st->rewind && b > 0 && (b % st->blocks_per_cycle) == 0) {
+    noodle_seek_file(*st->f, st->start_pos);
+  }
+
+  const uint32_t n = noodle_stream_block_len(st, b);
+  const uint32_t got = (uint32_t)noodle_read_float_block(*st->f, dst, n);
+  for (uint32_t i = got; i < n; i++) dst[i] = 0.0f;
+  return got;
+}
+
+#if NOODLE_PREFETCH
+
+// Single-producer/single-consumer ring. The reader only advances produced,
+// the consumer only advances released; slot b % depth is free to refill once
+// released > b - depth.
+typedef struct {
+  float *ring;
+  uint32_t *got;
+  uint16_t depth;
+  std::atomic<uint32_t> produced;
+  std::atomic<uint32_t> released;
+  std::atomic<bool> stop;
+#if defined(NOODLE_PREFETCH_FREERTOS)
+  TaskHandle_t task;
+  // Binary semaphores given after every change of the matching counter, so a
+  // waiter wakes as soon as the other side moves instead of on the next tick.
+  // Waiters re-check their condition, so coalesced gives are harmless.
+  SemaphoreHandle_t produced_sem;
+  SemaphoreHandle_t released_sem;
+  SemaphoreHandle_t exited_sem;  // given once, as the reader's last access
+#else
+  pthread_t thread;
+#endif
+} NoodleStreamAsync;
+
+// Block until the reader has produced more (released = false) or the consumer
+// has released more (released = true). Hosts just yield.
+static inline void noodle_stream_wait(NoodleStreamAsync *a, bool released) {
+#if defined(NOODLE_PREFETCH_FREERTOS)
+  xSemaphoreTake(released ? a->released_sem : a->produced_sem, portMAX_DELAY);
+#else
+  (void)a;
+  (void)released;
+  sched_yield();
+#endif
+}
+
+static inline void noodle_stream_signal(NoodleStreamAsync *a, bool released) {
+#if defined(NOODLE_PREFETCH_FREERTOS)
+  xSemaphoreGive(released ? a->released_sem : a->produced_sem);
+#else
+  (void)a;
+  (void)released;
+#endif
+}
+
+static void noodle_stream_reader(NoodleStream *st) {
+  NoodleStreamAsync *a = (NoodleStreamAsync *)st->async;
+
+  for (uint32_t b = 0; b < st->total_blocks; b++) {
+    while (b - a->released.load(std::memory_order_acquire) >= a->depth) {
+      if (a->stop.load(std::memory_order_relaxed)) break;
+      noodle_stream_wait(a, true);
+    }
+    if (a->stop.load(std::memory_order_relaxed)) break;
+
+    const uint16_t slot = (uint16_t)(b % a->depth);
+    a->got[slot] = noodle_stream_read(st, b, a->ring + (uint32_t)slot * st->block_floats);
+    a->produced.store(b + 1, std::memory_order_release);
+    noodle_stream_signal(a, false);
+  }
+}
+
+#if defined(NOODLE_PREFETCH_FREERTOS)
+static void noodle_stream_task(void *arg) {
+  NoodleStream *st = (NoodleStream *)arg;
+  noodle_stream_reader(st);
+  xSemaphoreGive(((NoodleStreamAsync *)st->async)->exited_sem);
+  vTaskDelete(NULL);
+}
+#else
+static void *noodle_stream_thread(void *arg) {
+  noodle_stream_reader((NoodleStream *)arg);
+  return NULL;
+}
+#endif
+
+static void noodle_stream_free_async(NoodleStream *st) {
+  NoodleStreamAsync *a = (NoodleStreamAsync *)st->async;
+  if (!a) return;
+  free(a->ring);
+  free(a->got);
+#if defined(NOODLE_PREFETCH_FREERTOS)
+  if (a->produced_sem) vSemaphoreDelete(a->produced_sem);
+  if (a->released_sem) vSemaphoreDelete(a->released_sem);
+  if (a->exited_sem) vSemaphoreDelete(a->exited_sem);
+#endif
+  delete a;
+  st->async = NULL;
+}
+
+static void noodle_stream_start_async(NoodleStream *st, uint16_t depth) {
+  if (st->total_blocks < 2) return;
+  if (depth < 2) depth = 2;
+  if (depth > st->total_blocks) depth = (uint16_t)st->total_blocks;
+
+  NoodleStreamAsync *a = new (std::nothrow) NoodleStreamAsync();
+  if (!a) return;
+  st->async = a;
+
+  a->depth = depth;
+  a->ring = (float *)malloc((size_t)depth * st->block_floats * sizeof(float));
+  a->got = (uint32_t *)malloc((size_t)depth * sizeof(uint32_t));
+  a->produced.store(0);
+  a->released.store(0);
+  a->stop.store(false);
+  if (!a->ring || !a->got) {
+    noodle_stream_free_async(st);
+    return;
+  }
+
+#if defined(NOODLE_PREFETCH_FREERTOS)
+  a->produced_sem = xSemaphoreCreateBinary();
+  a->released_sem = xSemaphoreCreateBinary();
+  a->exited_sem = xSemaphoreCreateBinary();
+  if (!a->produced_sem || !a->released_sem || !a->exited_sem) {
+    noodle_stream_free_async(st);
+    return;
+  }
+
+  BaseType_t ok;
+  #if portNUM_PROCESSORS > 1
+    // Keep the reader off the compute core.
+    ok = xTaskCreatePinnedToCore(noodle_stream_task, "ndl_prefetch", 4096, st,
+                                 uxTaskPriorityGet(NULL), &a->task,
+                                 1 - xPortGetCoreID());
+  #else
+    ok = xTaskCreate(noodle_stream_task, "ndl_prefetch", 4096, st,
+                     uxTaskPriorityGet(NULL), &a->task);
+  #endif
+  if (ok != pdPASS) noodle_stream_free_async(st);
+#else
+  if (pthread_create(&a->thread, NULL, noodle_stream_thread, st) != 0) {
+    noodle_stream_free_async(st);
+  }
+#endif
+}
+
+#endif  // NOODLE_PREFETCH
+
+void noodle_stream_begin(NoodleStream *st,
+                         NDL_File &f,
+                         float *buf,
+                         uint32_t block_floats,
+                         uint32_t cycle_floats,
+                         uint16_t cycles,
+                         bool rewind,
+                         uint16_t depth) {
+  st->f = &f;
+  st->buf = buf;
+  st->block_floats = block_floats ? block_floats : 1;
+  st->cycle_floats = cycle_floats;
+  st->blocks_per_cycle = (cycle_floats + st->block_floats - 1) / st->block_floats;
+  st->total_blocks = st->blocks_per_cycle * cycles;
+  st->next_block = 0;
+  st->start_pos = (uint32_t)f.position();
+  st->rewind = rewind;
+  st->async = NULL;
+
+#if NOODLE_PREFETCH
+  noodle_stream_start_async(st, depth);
+#else
+  (void)depth;
+#endif
+}
+
+float *noodle_stream_next(NoodleStream *st, uint32_t *n) {
+  const uint32_t b = st->next_block;
+  if (b >= st->total_blocks) return NULL;
+  st->next_block++;
+
+#if NOODLE_PREFETCH
+  NoodleStreamAsync *a = (NoodleStreamAsync *)st->async;
+  if (a) {
+    // Hand the previous block back, then wait for the reader to deliver b.
+    a->released.store(b, std::memory_order_release);
+    noodle_stream_signal(a, true);
+    while (a->produced.load(std::memory_order_acquire) <= b) noodle_stream_wait(a, false);
+
+    const uint16_t slot = (uint16_t)(b % a->depth);
+    if (n) *n = a->got[slot];
+    return a->ring + (uint32_t)slot * st->block_floats;
+  }
+#endif
+
+  const uint32_t got = noodle_stream_read(st, b, st->buf);
+  if (n) *n = got;
+  return st->buf;
+}
+
+void noodle_stream_end(NoodleStream *st) {
+#if NOODLE_PREFETCH
+  NoodleStreamAsync *a = (NoodleStreamAsync *)st->async;
+  if (a) {
+    a->stop.store(true, std::memory_order_relaxed);
+#if defined(NOODLE_PREFETCH_FREERTOS)
+    noodle_stream_signal(a, true);  // wake a reader waiting for a free slot
+    xSemaphoreTake(a->exited_sem, portMAX_DELAY);
+#else
+    pthread_join(a->thread, NULL);
+#endif
+    noodle_stream_free_async(st);
+  }
+#endif
+  st->next_block = st->total_blocks;
+}
+
+// ===== Write-behind output =====
+
+#if NOODLE_FILE_FORMAT == NOODLE_FILE_FORMAT_BIN && NOODLE_WRITE_BUFFER > 0
+
+static NDL_File *out_file = NULL;   // handle the pending bytes belong to
+static size_t out_len = 0;
+
+#if NOODLE_WRITE_THREAD
+
+// Two blocks: compute fills out_buf[out_fill] while the writer thread drains
+// the other one. A single condition variable signals both directions.
+static uint8_t out_buf[2][NOODLE_WRITE_BUFFER];
+static uint8_t out_fill = 0;
+
+static pthread_mutex_t out_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t out_cond = PTHREAD_COND_INITIALIZER;
+static bool out_thread_started = false;
+static bool out_job_pending = false;
+static NDL_File *out_job_file = NULL;
+static const uint8_t *out_job_data = NULL;
+static size_t out_job_len = 0;
+
+static void *noodle_out_worker(void *) {
+  pthread_mutex_lock(&out_mutex);
+  for (;;) {
+    while (!out_job_pending) pthread_cond_wait(&out_cond, &out_mutex);
+
+    NDL_File *f = out_job_file;
+    const uint8_t *data = out_job_data;
+    const size_t n = out_job_len;
+
+    pthread_mutex_unlock(&out_mutex);
+    noodle_write_raw(*f, data, n);
+    pthread_mutex_lock(&out_mutex);
+
+    out_job_pending = false;
+    pthread_cond_broadcast(&out_cond);
+  }
+  return NULL;
+}
+
+static void noodle_out_wait_idle(void) {
+  pthread_mutex_lock(&out_mutex);
+  while (out_job_pending) pthread_cond_wait(&out_cond, &out_mutex);
+  pthread_mutex_unlock(&out_mutex);
+}
+
+// Hand the filled block to the writer thread and switch to the other block.
+static void noodle_out_submit(void) {
+  if (!out_file || out_len == 0) return;
+
+  pthread_mutex_lock(&out_mutex);
+  if (!out_thread_started) {
+    pthread_t tid;
+    if (pthread_create(&tid, NULL, noodle_out_worker, NULL) == 0) {
+      pthread_detach(tid);
+      out_thread_started = true;
+    }
+  }
+  if (!out_thread_started) {
+    // No thread available: degrade to a synchronous write.
+    pthread_mutex_unlock(&out_mutex);
+    noodle_write_raw(*out_file, out_buf[out_fill], out_len);
+    out_len = 0;
+    return;
+  }
+
+  while (out_job_pending) pthread_cond_wait(&out_cond, &out_mutex);
+  out_job_file = out_file;
+  out_job_data = out_buf[out_fill];
+  out_job_len = out_len;
+  out_job_pending = true;
+  pthread_cond_broadcast(&out_cond);
+  pthread_mutex_unlock(&out_mutex);
+
+  out_fill ^= 1;
+  out_len = 0;
+}
+
+#else
+
+static uint8_t out_buf[1][NOODLE_WRITE_BUFFER];
+static const uint8_t out_fill = 0;
+
+static void noodle_out_wait_idle(void) {}
+
+static void noodle_out_submit(void) {
+  if (!out_file || out_len == 0) return;
+  noodle_write_raw(*out_file, out_buf[out_fill], out_len);
+  out_len = 0;
+}
+
+#endif  // NOODLE_WRITE_THREAD
+
+void noodle_out_float(NDL_File &fo, float v) {
+  if (out_file != &fo) {
+    noodle_out_submit();
+    out_file = &fo;
+  }
+  if (out_len + sizeof(v) > NOODLE_WRITE_BUFFER) noodle_out_submit();
+
+  memcpy(out_buf[out_fill] + out_len, &v, sizeof(v));
+  out_len += sizeof(v);
+}
+
+void noodle_out_flush(NDL_File &fo) {
+  if (out_file == &fo) {
+    noodle_out_submit();
+    out_file = NULL;
+  }
+  noodle_out_wait_idle();
+}
+
+#else
+
+void noodle_out_float(NDL_File &fo, float v) {
+  noodle_write_float(fo, v);
+}
+
+void noodle_out_flush(NDL_File &fo) {
+  (void)fo;
+}
+
+#endif
+
+void noodle_out_close(NDL_File &fo) {
+  noodle_out_flush(fo);
+  fo.close();
+}
+
 void noodle_delete_file(const char *fn) {
   noodle_fs_remove(fn);
 }
@@ -229,27 +769,23 @@ void noodle_array_to_file(float *array,
                           uint16_t n) {
   fo = noodle_fs_open_write(fn);
   for (uint16_t i = 0; i < n; i++)
-    noodle_write_float(fo, array[i]);
-  fo.close();
+    noodle_out_float(fo, array[i]);
+  noodle_out_close(fo);
 }
 
 void noodle_array_to_file(float *array,
                           NDL_File &fo,
                           uint16_t n) {
   for (uint16_t i = 0; i < n; i++)
-    noodle_write_float(fo, array[i]);
+    noodle_out_float(fo, array[i]);
+  noodle_out_flush(fo);
 }
 
 void noodle_grid_to_file(byte *grid,
                          const char *fn,
                          uint16_t n) {
   fo = noodle_fs_open_write(fn);
-  for (uint16_t i = 0; i < n; i++) {
-    const uint16_t row = i * n;
-    for (uint16_t j = 0; j < n; j++) {
-      noodle_write_float(fo, (float)grid[row + j]);
-    }
-  }
+  noodle_grid_to_file(grid, fo, n);
   fo.close();
 }
 
@@ -257,23 +793,19 @@ void noodle_grid_to_file(byte *grid,
                          NDL_File &fo,
                          uint16_t n) {
   for (uint16_t i = 0; i < n; i++) {
-    const uint16_t row = i * n;
+    const uint32_t row = (uint32_t)i * n;
     for (uint16_t j = 0; j < n; j++) {
-      noodle_write_float(fo, (float)grid[row + j]);
+      noodle_out_float(fo, (float)grid[row + j]);
     }
   }
+  noodle_out_flush(fo);
 }
 
 void noodle_grid_to_file(float *grid,
                          const char *fn,
                          uint16_t n) {
   fo = noodle_fs_open_write(fn);
-  for (uint16_t i = 0; i < n; i++) {
-    const uint16_t row = i * n;
-    for (uint16_t j = 0; j < n; j++) {
-      noodle_write_float(fo, grid[row + j]);
-    }
-  }
+  noodle_grid_to_file(grid, fo, n);
   fo.close();
 }
 
@@ -281,11 +813,12 @@ void noodle_grid_to_file(float *grid,
                          NDL_File &fo,
                          uint16_t n) {
   for (uint16_t i = 0; i < n; i++) {
-    const uint16_t row = i * n;
+    const uint32_t row = (uint32_t)i * n;
     for (uint16_t j = 0; j < n; j++) {
-      noodle_write_float(fo, grid[row + j]);
+      noodle_out_float(fo, grid[row + j]);
     }
   }
+  noodle_out_flush(fo);
 }
 
 // ===== Read helpers moved from noodle_conv.cpp =====
@@ -294,37 +827,35 @@ void noodle_array_from_file(const char *fn,
                             float *buffer,
                             uint16_t K) {
   fi = noodle_fs_open_read(fn);
-  for (uint16_t i = 0; i < K; i++)
-    buffer[i] = noodle_read_float(fi);
+  noodle_array_from_file(fi, buffer, K);
   fi.close();
 }
 
 void noodle_array_from_file(NDL_File &fi,
                             float *buffer,
                             uint16_t K) {
-  for (uint16_t i = 0; i < K; i++)
-    buffer[i] = noodle_read_float(fi);
+  noodle_read_floats(fi, buffer, K);
 }
 
 void noodle_grid_from_file(const char *fn,
                            byte *buffer,
                            uint16_t K) {
   fi = noodle_fs_open_read(fn);
-  for (uint16_t i = 0; i < K; i++) {
-    for (uint16_t j = 0; j < K; j++) {
-      buffer[i * K + j] = noodle_read_float(fi);
-    }
-  }
+  noodle_grid_from_file(fi, buffer, K);
   fi.close();
 }
 
 void noodle_grid_from_file(NDL_File &fi,
                            byte *buffer,
                            uint16_t K) {
-  for (uint16_t i = 0; i < K; i++) {
-    for (uint16_t j = 0; j < K; j++) {
-      buffer[i * K + j] = noodle_read_float(fi);
-    }
+  float chunk[NOODLE_IO_CHUNK / sizeof(float)];
+  const uint32_t chunk_n = NOODLE_IO_CHUNK / sizeof(float);
+  const uint32_t n = (uint32_t)K * K;
+
+  for (uint32_t i = 0; i < n; i += chunk_n) {
+    const uint32_t m = (n - i < chunk_n) ? (n - i) : chunk_n;
+    noodle_read_floats(fi, chunk, m);
+    for (uint32_t j = 0; j < m; j++) buffer[i + j] = chunk[j];
   }
 }
 
@@ -332,21 +863,21 @@ void noodle_grid_from_file(const char *fn,
                            int8_t *buffer,
                            uint16_t K) {
   fi = noodle_fs_open_read(fn);
-  for (uint16_t i = 0; i < K; i++) {
-    for (uint16_t j = 0; j < K; j++) {
-      buffer[i * K + j] = noodle_read_float(fi);
-    }
-  }
+  noodle_grid_from_file(fi, buffer, K);
   fi.close();
 }
 
 void noodle_grid_from_file(NDL_File &fi,
                            int8_t *buffer,
                            uint16_t K) {
-  for (uint16_t i = 0; i < K; i++) {
-    for (uint16_t j = 0; j < K; j++) {
-      buffer[i * K + j] = noodle_read_float(fi);
-    }
+  float chunk[NOODLE_IO_CHUNK / sizeof(float)];
+  const uint32_t chunk_n = NOODLE_IO_CHUNK / sizeof(float);
+  const uint32_t n = (uint32_t)K * K;
+
+  for (uint32_t i = 0; i < n; i += chunk_n) {
+    const uint32_t m = (n - i < chunk_n) ? (n - i) : chunk_n;
+    noodle_read_floats(fi, chunk, m);
+    for (uint32_t j = 0; j < m; j++) buffer[i + j] = chunk[j];
   }
 }
 
@@ -354,20 +885,13 @@ void noodle_grid_from_file(const char *fn,
                            float *buffer,
                            uint16_t K) {
   fi = noodle_fs_open_read(fn);
-  for (uint16_t i = 0; i < K; i++) {
-    for (uint16_t j = 0; j < K; j++) {
-      buffer[i * K + j] = noodle_read_float(fi);
-    }
-  }
+  noodle_grid_from_file(fi, buffer, K);
   fi.close();
 }
 
 void noodle_grid_from_file(NDL_File &fi,
                            float *buffer,
                            uint16_t K) {
-  for (uint16_t i = 0; i < K; i++) {
-    for (uint16_t j = 0; j < K; j++) {
-      buffer[i * K + j] = noodle_read_float(fi);
-    }
-  }
+  // Float grids land directly in the caller's buffer: one read per plane.
+  noodle_read_floats(fi, buffer, (uint32_t)K * K);
 }
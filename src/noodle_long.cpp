@@ -0,0 +1,427 @@
+/**
+ * @file noodle_long.cpp
+ * @brief Long-sequence Conv1D stacks split into overlapping chunks.
+ * @ingroup noodle_api
+ */
+#include "noodle_internal.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if NOODLE_CONV1D_THREADS
+  #include <atomic>
+  #include <pthread.h>
+#endif
+
+#if NOODLE_CONV1D_THREADS
+typedef std::atomic<uint32_t> noodle_long_counter;
+#else
+typedef uint32_t noodle_long_counter;
+#endif
+
+// One layer of the stack with its weights prepared for the whole call.
+// Direct layers keep the kernels packed [O/B][I][K][B] for
+// noodle_do_conv1d_block(); FFT layers keep the spectra of every kernel,
+// [O][I][re, im][N], and the twiddles of size N.
+struct NoodleLongLayer {
+  const ConvMem *conv;
+  uint16_t I;
+  uint16_t O;
+  int64_t V;          // Output length of the layer over the whole signal.
+  uint32_t N;         // FFT size, 0 for the direct kernel.
+  NoodleBuffer params;
+};
+
+struct NoodleLongJob {
+  const float *in;
+  uint32_t L;
+  NoodleLongLayer *layers;
+  uint8_t n_layers;
+  float *out;
+  uint32_t Lout;
+  uint32_t chunk;
+  uint32_t n_chunks;
+  uint32_t span;      // Longest per-layer input, chunk plus the halo.
+  uint16_t C;         // Widest channel count between layers.
+  size_t ws_floats;
+  CBFPtr progress_cb;
+  noodle_long_counter next;
+  noodle_long_counter done;
+  noodle_long_counter failed;
+};
+
+// ===== FFT =====
+
+// In-place radix-2 FFT of n = 2^m complex values. @p tw holds the n/2
+// forward twiddles exp(-2*pi*i*k/n) as [re][im]; the inverse uses their
+// conjugates and is not scaled.
+static void noodle_fft(float *re, float *im, uint32_t n, const float *tw, bool inverse) {
+  const float *tw_re = tw;
+  const float *tw_im = tw + n / 2;
+
+  for (uint32_t i = 1, j = 0; i < n; i++) {
+    uint32_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      float t = re[i]; re[i] = re[j]; re[j] = t;
+      t = im[i]; im[i] = im[j]; im[j] = t;
+    }
+  }
+
+  for (uint32_t len = 2; len <= n; len <<= 1) {
+    const uint32_t half = len >> 1;
+    const uint32_t step = n / len;
+    for (uint32_t i = 0; i < n; i += len) {
+      for (uint32_t k = 0; k < half; k++) {
+        const float wr = tw_re[k * step];
+        const float wi = inverse ? -tw_im[k * step] : tw_im[k * step];
+        const uint32_t a = i + k;
+        const uint32_t b = a + half;
+        const float xr = re[b] * wr - im[b] * wi;
+        const float xi = re[b] * wi + im[b] * wr;
+        re[b] = re[a] - xr;
+        im[b] = im[a] - xi;
+        re[a] += xr;
+        im[a] += xi;
+      }
+    }
+  }
+}
+
+// ===== Layer kernels =====
+
+// Valid (unpadded) convolution of @p x, I rows of len_in samples, into
+// len_in - K + 1 outputs per channel at rows of @p y spaced ldy apart, with
+// bias and activation. Matches noodle_conv1d() per sample.
+static void noodle_long_direct(const NoodleLongLayer &ly, const float *x, uint32_t len_in,
+                               float *y, uint32_t ldy, float *acc) {
+  const ConvMem &conv = *ly.conv;
+  const uint32_t len_out = len_in - conv.K + 1;
+
+#if NOODLE_CONV_OBLOCK > 1
+  const uint8_t B = NOODLE_CONV_OBLOCK;
+  const uint32_t KB = (uint32_t)conv.K * B;
+  const float *wp = ly.params.data;
+
+  for (uint16_t o = 0; o < ly.O; o += B) {
+    const uint16_t ob = (ly.O - o < B) ? (uint16_t)(ly.O - o) : (uint16_t)B;
+    const float *wblk = wp + (uint32_t)(o / B) * ly.I * KB;
+
+    for (uint32_t p = 0; p < len_out * B; p++) acc[p] = 0.0f;
+    for (uint16_t i = 0; i < ly.I; i++)
+      noodle_do_conv1d_block(x + (uint32_t)i * len_in, wblk + (uint32_t)i * KB,
+                             conv.K, (uint16_t)len_in, acc, 0, 1);
+
+    for (uint16_t b = 0; b < ob; b++) {
+      const float bias = conv.bias ? conv.bias[o + b] : 0.0f;
+      float *row = y + (uint32_t)(o + b) * ldy;
+      for (uint32_t t = 0; t < len_out; t++) {
+        float v = acc[t * B + b] + bias;
+        if ((conv.act == ACT_RELU) && (v < 0.0f)) v = 0.0f;
+        row[t] = v;
+      }
+    }
+  }
+#else
+  for (uint16_t o = 0; o < ly.O; o++) {
+    for (uint32_t t = 0; t < len_out; t++) acc[t] = 0.0f;
+    for (uint16_t i = 0; i < ly.I; i++)
+      noodle_do_conv1d((float *)x + (uint32_t)i * len_in,
+                       (float *)conv.weight + ((uint32_t)o * ly.I + i) * conv.K,
+                       (uint16_t)len_in, conv.K, acc, 0, 1);
+
+    const float bias = conv.bias ? conv.bias[o] : 0.0f;
+    float *row = y + (uint32_t)o * ldy;
+    for (uint32_t t = 0; t < len_out; t++) {
+      float v = acc[t] + bias;
+      if ((conv.act == ACT_RELU) && (v < 0.0f)) v = 0.0f;
+      row[t] = v;
+    }
+  }
+#endif
+}
+
+// Same result as noodle_long_direct() by overlap-save: segments of
+// N - K + 1 outputs are one product of spectra per channel pair. The
+// spectrum of x times the conjugate kernel spectrum is the circular
+// correlation, which equals the linear one for the first N - K + 1 lags.
+// Scratch is [I][re, im][N] input spectra plus one [re, im][N] output.
+static void noodle_long_fft(const NoodleLongLayer &ly, const float *x, uint32_t len_in,
+                            float *y, uint32_t ldy, float *ws) {
+  const ConvMem &conv = *ly.conv;
+  const uint32_t N = ly.N;
+  const uint32_t len_out = len_in - conv.K + 1;
+  const uint32_t m = N - conv.K + 1;
+  const float *spec = ly.params.data;
+  const float *tw = spec + (uint32_t)ly.O * ly.I * 2 * N;
+  const float scale = 1.0f / (float)N;
+
+  float *X = ws;
+  float *Yr = X + (uint32_t)ly.I * 2 * N;
+  float *Yi = Yr + N;
+
+  for (uint32_t s0 = 0; s0 < len_out; s0 += m) {
+    const uint32_t ms = (len_out - s0 < m) ? len_out - s0 : m;
+    const uint32_t seg = ms + conv.K - 1;
+
+    for (uint16_t i = 0; i < ly.I; i++) {
+      float *re = X + (uint32_t)i * 2 * N;
+      float *im = re + N;
+      const float *src = x + (uint32_t)i * len_in + s0;
+      for (uint32_t t = 0; t < seg; t++) re[t] = src[t];
+      for (uint32_t t = seg; t < N; t++) re[t] = 0.0f;
+      for (uint32_t t = 0; t < N; t++) im[t] = 0.0f;
+      noodle_fft(re, im, N, tw, false);
+    }
+
+    for (uint16_t o = 0; o < ly.O; o++) {
+      for (uint32_t f = 0; f < N; f++) Yr[f] = Yi[f] = 0.0f;
+      for (uint16_t i = 0; i < ly.I; i++) {
+        const float *xr = X + (uint32_t)i * 2 * N;
+        const float *xi = xr + N;
+        const float *wr = spec + ((uint32_t)o * ly.I + i) * 2 * N;
+        const float *wi = wr + N;
+        for (uint32_t f = 0; f < N; f++) {
+          Yr[f] += xr[f] * wr[f] + xi[f] * wi[f];
+          Yi[f] += xi[f] * wr[f] - xr[f] * wi[f];
+        }
+      }
+      noodle_fft(Yr, Yi, N, tw, true);
+
+      const float bias = conv.bias ? conv.bias[o] : 0.0f;
+      float *row = y + (uint32_t)o * ldy + s0;
+      for (uint32_t t = 0; t < ms; t++) {
+        float v = Yr[t] * scale + bias;
+        if ((conv.act == ACT_RELU) && (v < 0.0f)) v = 0.0f;
+        row[t] = v;
+      }
+    }
+  }
+}
+
+// Pack the direct kernels or transform the FFT kernels of one layer.
+static bool noodle_long_prepare(NoodleLongLayer &ly) {
+  const ConvMem &conv = *ly.conv;
+  noodle_buffer_init(&ly.params);
+
+  if (ly.N) {
+    const uint32_t N = ly.N;
+    float *spec = noodle_buffer_require(&ly.params, (size_t)ly.O * ly.I * 2 * N + N);
+    if (!spec) return false;
+    float *tw = spec + (uint32_t)ly.O * ly.I * 2 * N;
+    for (uint32_t k = 0; k < N / 2; k++) {
+      const double a = -6.283185307179586 * (double)k / (double)N;
+      tw[k] = (float)cos(a);
+      tw[N / 2 + k] = (float)sin(a);
+    }
+    for (uint32_t p = 0; p < (uint32_t)ly.O * ly.I; p++) {
+      float *re = spec + p * 2 * N;
+      float *im = re + N;
+      for (uint32_t t = 0; t < N; t++) {
+        re[t] = (t < conv.K) ? conv.weight[p * conv.K + t] : 0.0f;
+        im[t] = 0.0f;
+      }
+      noodle_fft(re, im, N, tw, false);
+    }
+    return true;
+  }
+
+#if NOODLE_CONV_OBLOCK > 1
+  const uint8_t B = NOODLE_CONV_OBLOCK;
+  const uint16_t blocks = (uint16_t)((ly.O + B - 1) / B);
+  float *wp = noodle_buffer_require(&ly.params, (size_t)blocks * ly.I * conv.K * B);
+  if (!wp) return false;
+  // [O/B][I][K][B], zero weights for the missing channels of a tail block.
+  for (uint16_t o = 0; o < blocks * B; o += B)
+    for (uint16_t i = 0; i < ly.I; i++)
+      for (uint16_t k = 0; k < conv.K; k++)
+        for (uint8_t b = 0; b < B; b++)
+          *wp++ = (o + b < ly.O) ? conv.weight[((uint32_t)(o + b) * ly.I + i) * conv.K + k] : 0.0f;
+#endif
+  return true;
+}
+
+// ===== Chunks =====
+
+// Final outputs [j0, j1) of one chunk. Working back through the stack gives
+// the range each layer must produce; ranges reach into the zero padding at
+// the signal ends, where the layer outputs are forced to zero exactly as the
+// padding of the next layer would be.
+static void noodle_long_chunk(NoodleLongJob &job, uint32_t c, float *ws) {
+  const uint8_t n = job.n_layers;
+  int64_t a[256];
+  int64_t b[256];
+  a[n] = (int64_t)c * job.chunk;
+  b[n] = a[n] + job.chunk;
+  if (b[n] > job.Lout) b[n] = job.Lout;
+  for (uint8_t l = n; l > 0; l--) {
+    const ConvMem &conv = *job.layers[l - 1].conv;
+    a[l - 1] = a[l] - conv.P;
+    b[l - 1] = b[l] - conv.P + conv.K - 1;
+  }
+
+  float *cur = ws;
+  float *nxt = cur + (size_t)job.C * job.span;
+  float *acc = nxt + (size_t)job.C * job.span;
+
+  const uint32_t len0 = (uint32_t)(b[0] - a[0]);
+  const uint16_t I0 = job.layers[0].I;
+  for (uint16_t i = 0; i < I0; i++) {
+    const float *src = job.in + (size_t)i * job.L;
+    float *dst = cur + (uint32_t)i * len0;
+    for (uint32_t t = 0; t < len0; t++) {
+      const int64_t idx = a[0] + t;
+      dst[t] = (idx < 0 || idx >= (int64_t)job.L) ? 0.0f : src[idx];
+    }
+  }
+
+  for (uint8_t l = 1; l <= n; l++) {
+    const NoodleLongLayer &ly = job.layers[l - 1];
+    const uint32_t len_in = (uint32_t)(b[l - 1] - a[l - 1]);
+    const uint32_t len_out = (uint32_t)(b[l] - a[l]);
+    const bool last = (l == n);
+    float *y = last ? job.out + a[n] : nxt;
+    const uint32_t ldy = last ? job.Lout : len_out;
+
+    if (ly.N) noodle_long_fft(ly, cur, len_in, y, ldy, acc);
+    else noodle_long_direct(ly, cur, len_in, y, ldy, acc);
+
+    if (!last) {
+      for (uint32_t t = 0; t < len_out; t++) {
+        const int64_t idx = a[l] + t;
+        if (idx >= 0 && idx < ly.V) continue;
+        for (uint16_t o = 0; o < ly.O; o++) y[(uint32_t)o * len_out + t] = 0.0f;
+      }
+      float *swap = cur;
+      cur = nxt;
+      nxt = swap;
+    }
+  }
+}
+
+// Claims chunks until none are left. Only the calling thread reports
+// progress, so the callback never runs concurrently.
+static void noodle_long_run(NoodleLongJob &job, bool report) {
+  NoodleBuffer ws;
+  noodle_buffer_init(&ws);
+  if (!noodle_buffer_require(&ws, job.ws_floats)) {
+    job.failed = 1;
+    return;
+  }
+
+  for (;;) {
+    const uint32_t c = job.next++;
+    if (c >= job.n_chunks || job.failed) break;
+    noodle_long_chunk(job, c, ws.data);
+    const uint32_t done = ++job.done;
+    if (report && job.progress_cb) job.progress_cb((float)done / (float)job.n_chunks);
+  }
+  noodle_buffer_free(&ws);
+}
+
+#if NOODLE_CONV1D_THREADS
+static void *noodle_long_thread(void *arg) {
+  noodle_long_run(*(NoodleLongJob *)arg, false);
+  return NULL;
+}
+#endif
+
+uint32_t noodle_conv1d_long(const float *in,
+                            uint16_t n_inputs,
+                            uint32_t L,
+                            const ConvMem *layers,
+                            uint8_t n_layers,
+                            float *out,
+                            uint8_t n_threads,
+                            CBFPtr progress_cb) {
+  if (!in || !out || !layers || n_layers == 0 || n_inputs == 0 || L == 0) return 0;
+
+  NoodleLongLayer *ly = (NoodleLongLayer *)calloc(n_layers, sizeof(NoodleLongLayer));
+  if (!ly) return 0;
+
+  // Lengths of every layer over the whole signal, and the halo one chunk
+  // needs on top of its outputs.
+  uint16_t I = n_inputs;
+  uint16_t C = n_inputs;
+  int64_t V = L;
+  uint32_t halo = 0;
+  uint32_t fft_ws = 0;
+  uint8_t ready = 0;
+  bool ok = true;
+
+  for (uint8_t l = 0; l < n_layers && ok; l++) {
+    const ConvMem &conv = layers[l];
+    V = V + 2 * (int64_t)conv.P - conv.K + 1;
+    ok = conv.weight && conv.K > 0 && conv.S == 1 && conv.O > 0 && V >= 1;
+    if (!ok) break;
+
+    ly[l].conv = &conv;
+    ly[l].I = I;
+    ly[l].O = conv.O;
+    ly[l].V = V;
+    ly[l].N = 0;
+#if NOODLE_CONV1D_FFT_K > 0
+    if (conv.K >= NOODLE_CONV1D_FFT_K) {
+      uint32_t N = 1;
+      while (N < 4u * conv.K) N <<= 1;
+      ly[l].N = N;
+      const uint32_t need = ((uint32_t)I * 2 + 2) * N;
+      if (need > fft_ws) fft_ws = need;
+    }
+#endif
+    ok = noodle_long_prepare(ly[l]);
+    if (ok) ready = (uint8_t)(l + 1);
+
+    halo += conv.K - 1;
+    I = conv.O;
+    if (I > C) C = I;
+  }
+
+  // Every per-layer input of a chunk must fit the 16-bit kernel lengths.
+  uint32_t Lout = 0;
+  if (ok && V <= 0xFFFFFFFFll && halo < 0xFFFFu) {
+    Lout = (uint32_t)V;
+    uint32_t chunk = NOODLE_CONV1D_CHUNK;
+    if (chunk > 0xFFFFu - halo) chunk = 0xFFFFu - halo;
+    if (chunk > Lout) chunk = Lout;
+
+    NoodleLongJob job;
+    job.in = in;
+    job.L = L;
+    job.layers = ly;
+    job.n_layers = n_layers;
+    job.out = out;
+    job.Lout = Lout;
+    job.chunk = chunk;
+    job.n_chunks = (Lout + chunk - 1) / chunk;
+    job.span = chunk + halo;
+    job.C = C;
+    const uint32_t acc = (NOODLE_CONV_OBLOCK > 1 ? NOODLE_CONV_OBLOCK : 1) * job.span;
+    job.ws_floats = (size_t)2 * C * job.span + (acc > fft_ws ? acc : fft_ws);
+    job.progress_cb = progress_cb;
+    job.next = 0;
+    job.done = 0;
+    job.failed = 0;
+
+#if NOODLE_CONV1D_THREADS
+    pthread_t tid[255];
+    uint8_t started = 0;
+    if (n_threads > job.n_chunks) n_threads = (uint8_t)job.n_chunks;
+    for (uint8_t t = 1; t < n_threads; t++) {
+      if (pthread_create(&tid[started], NULL, noodle_long_thread, &job) != 0) break;
+      started++;
+    }
+    noodle_long_run(job, true);
+    for (uint8_t t = 0; t < started; t++) pthread_join(tid[t], NULL);
+#else
+    (void)n_threads;
+    noodle_long_run(job, true);
+#endif
+    if (job.failed) Lout = 0;
+  }
+
+  for (uint8_t l = 0; l < ready; l++) noodle_buffer_free(&ly[l].params);
+  free(ly);
+  return Lout;
+}
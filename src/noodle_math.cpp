@@ -7,6 +7,10 @@
 
 
 float noodle_dot_float_block(const float *x, const float *w, uint16_t n) {
+#if NOODLE_SIMD
+  float v;
+  if (noodle_simd_dot(x, w, n, v)) return v;
+#endif
   float s0 = 0.0f;
   float s1 = 0.0f;
   float s2 = 0.0f;
@@ -120,6 +124,9 @@ uint16_t noodle_bn2d(float *x,
     const float t = beta[c] - s * mean[c];
 
     float *p = x + (uint32_t)c * plane;
+#if NOODLE_SIMD
+    if (noodle_simd_affine(p, plane, s, t, NOODLE_RELU_NONE)) continue;
+#endif
     for (uint16_t i = 0; i < plane; ++i) {
       p[i] = s * p[i] + t;
     }
@@ -152,6 +159,9 @@ uint16_t noodle_bn2d_relu(float *x,
     const float t = beta[c] - s * mean[c];
 
     float *p = x + (uint32_t)c * plane;
+#if NOODLE_SIMD
+    if (noodle_simd_affine(p, plane, s, t, NOODLE_RELU_POS)) continue;
+#endif
     for (uint16_t i = 0; i < plane; ++i) {
       const float y = s * p[i] + t;
       p[i] = (y > 0.0f) ? y : 0.0f;
@@ -211,6 +221,77 @@ uint16_t noodle_bn_relu(float *x,
   return noodle_bn2d_relu(x, C, W, bn_params, eps);
 }
 
+bool noodle_fold_bn(float *weight,
+                    float *bias,
+                    uint16_t n_outputs,
+                    uint32_t n_weights,
+                    const float *bn_params,
+                    float eps) {
+  if (!weight || !bias || !bn_params) return false;
+  const float *gamma, *beta, *mean, *var;
+  noodle_unpack_bn_params(bn_params, n_outputs, &gamma, &beta, &mean, &var);
+  for (uint16_t o = 0; o < n_outputs; ++o) {
+    const float inv_std = 1.0f / sqrtf(var[o] + eps);
+    const float s = gamma[o] * inv_std;
+    const float t = beta[o] - s * mean[o];
+
+    float *w = weight + (uint32_t)o * n_weights;
+    for (uint32_t i = 0; i < n_weights; ++i) w[i] *= s;
+    bias[o] = s * bias[o] + t;
+  }
+  return true;
+}
+
+// Stage a layer's parameters in the caller's writable arrays before folding.
+static bool noodle_fold_bn_stage(const float *src_w,
+                                 const float *src_b,
+                                 float *weight,
+                                 float *bias,
+                                 uint16_t n_outputs,
+                                 uint32_t n_weights) {
+  if (!src_w || !weight || !bias) return false;
+  if (src_w != weight) {
+    const uint32_t n = (uint32_t)n_outputs * n_weights;
+    for (uint32_t i = 0; i < n; ++i) weight[i] = src_w[i];
+  }
+  if (src_b != bias) {
+    for (uint16_t o = 0; o < n_outputs; ++o) bias[o] = src_b ? src_b[o] : 0.0f;
+  }
+  return true;
+}
+
+bool noodle_fold_bn(ConvMem &conv,
+                    uint16_t n_outputs,
+                    uint32_t n_weights,
+                    float *weight,
+                    float *bias,
+                    const float *bn_params,
+                    float eps) {
+  if (!bn_params) return false;
+  if (!noodle_fold_bn_stage(conv.weight, conv.bias, weight, bias, n_outputs, n_weights)) return false;
+  noodle_fold_bn(weight, bias, n_outputs, n_weights, bn_params, eps);
+  conv.weight = weight;
+  conv.bias = bias;
+  conv.winograd = nullptr;
+  noodle_winograd_clear();
+  return true;
+}
+
+bool noodle_fold_bn(FCNMem &fcn,
+                    uint16_t n_inputs,
+                    uint16_t n_outputs,
+                    float *weight,
+                    float *bias,
+                    const float *bn_params,
+                    float eps) {
+  if (!bn_params) return false;
+  if (!noodle_fold_bn_stage(fcn.weight, fcn.bias, weight, bias, n_outputs, n_inputs)) return false;
+  noodle_fold_bn(weight, bias, n_outputs, n_inputs, bn_params, eps);
+  fcn.weight = weight;
+  fcn.bias = bias;
+  return true;
+}
+
 uint16_t noodle_soft_max(float *input_output,
                          uint16_t n) {
   float max_val = input_output[0];
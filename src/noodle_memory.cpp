@@ -12,12 +12,13 @@
 
 extern size_t temp_buff1_capacity;
 extern size_t temp_buff2_capacity;
+extern size_t temp_buff3_capacity;
 
 #ifndef NOODLE_TEMP_EXTERNAL_CAPACITY_UNKNOWN
 #define NOODLE_TEMP_EXTERNAL_CAPACITY_UNKNOWN ((size_t)-1)
 #endif
 
-static float *noodle_alloc_temp_float(size_t required_floats) {
+float *noodle_alloc_temp_float(size_t required_floats) {
   if (required_floats == 0) return NULL;
 
   const size_t bytes = required_floats * sizeof(float);
@@ -72,6 +73,10 @@ float *noodle_temp2_require(size_t required_floats) {
   return noodle_temp_require_impl(&temp_buff2, &temp_buff2_capacity, required_floats);
 }
 
+float *noodle_temp3_require(size_t required_floats) {
+  return noodle_temp_require_impl(&temp_buff3, &temp_buff3_capacity, required_floats);
+}
+
 void noodle_temp_buffers_free(void) {
   if (temp_buff1 && temp_buff1_capacity != NOODLE_TEMP_EXTERNAL_CAPACITY_UNKNOWN) {
     free(temp_buff1);
@@ -79,10 +84,23 @@ void noodle_temp_buffers_free(void) {
   if (temp_buff2 && temp_buff2_capacity != NOODLE_TEMP_EXTERNAL_CAPACITY_UNKNOWN) {
     free(temp_buff2);
   }
+  free(temp_buff3);
   temp_buff1 = NULL;
   temp_buff2 = NULL;
+  temp_buff3 = NULL;
   temp_buff1_capacity = 0;
   temp_buff2_capacity = 0;
+  temp_buff3_capacity = 0;
+  noodle_winograd_clear();
+  noodle_conv1d_scratch_free();
+}
+
+void noodle_set_conv_budget(size_t bytes) {
+  conv_budget = bytes;
+}
+
+size_t noodle_get_conv_budget(void) {
+  return conv_budget;
 }
 
 float *noodle_create_buffer(uint16_t size) {
@@ -0,0 +1,290 @@
+/**
+ * @file noodle_model.cpp
+ * @brief Packed `.ndl` model container reader and mapped parameter source.
+ * @ingroup noodle_api
+ */
+#include "noodle_internal.h"
+#include <string.h>
+
+#if (defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)) && __has_include("esp_idf_version.h")
+  #include "esp_idf_version.h"
+  #include "esp_partition.h"
+  #define NOODLE_MAP_PARTITION 1
+  // IDF 5.1 gave partition mappings their own types; before that (IDF 4.4 in
+  // Arduino-ESP32 2.x) they are spi_flash mappings.
+  #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+    typedef esp_partition_mmap_handle_t noodle_part_handle_t;
+    #define NOODLE_PART_MMAP_DATA ESP_PARTITION_MMAP_DATA
+    #define noodle_part_munmap(h) esp_partition_munmap(h)
+  #else
+    typedef spi_flash_mmap_handle_t noodle_part_handle_t;
+    #define NOODLE_PART_MMAP_DATA SPI_FLASH_MMAP_DATA
+    #define noodle_part_munmap(h) spi_flash_munmap(h)
+  #endif
+#elif defined(NOODLE_USE_POSIX)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define NOODLE_MAP_MMAP 1
+#endif
+
+#ifndef NOODLE_MAP_PARTITION
+  #define NOODLE_MAP_PARTITION 0
+#endif
+#ifndef NOODLE_MAP_MMAP
+  #define NOODLE_MAP_MMAP 0
+#endif
+
+#define NOODLE_NDL_HEADER 16
+#define NOODLE_NDL_ENTRY  48
+
+static uint16_t noodle_ndl_u16(const uint8_t *p) {
+  return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static uint32_t noodle_ndl_u32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+         ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// True when table entry e carries exactly this name.
+static bool noodle_ndl_match(const uint8_t *e, const char *name, size_t len) {
+  if (memcmp(e, name, len) != 0) return false;
+  return len == NOODLE_NDL_NAME || e[len] == 0;
+}
+
+static void noodle_ndl_decode(const uint8_t *e, NoodleTensorInfo *info) {
+  memcpy(info->name, e, NOODLE_NDL_NAME);
+  info->name[NOODLE_NDL_NAME] = '\0';
+  info->dtype  = e[24];
+  info->layout = e[25];
+  info->rank   = e[26];
+  for (uint8_t d = 0; d < 4; d++) info->dims[d] = noodle_ndl_u16(e + 28 + 2 * d);
+  info->offset = noodle_ndl_u32(e + 36);
+  info->count  = noodle_ndl_u32(e + 40);
+}
+
+bool noodle_model_open(NoodleModel &model, const char *fn) {
+  model.count = 0;
+  model.align = 0;
+  if (!fn) return false;
+
+  model.file = noodle_fs_open_read(fn);
+  if (!model.file) return false;
+
+  uint8_t h[NOODLE_NDL_HEADER];
+  if (noodle_read_raw(model.file, h, sizeof(h)) != sizeof(h) ||
+      memcmp(h, "NDL1", 4) != 0 || noodle_ndl_u16(h + 4) != 1) {
+    model.file.close();
+    return false;
+  }
+
+  model.count = noodle_ndl_u16(h + 6);
+  model.align = noodle_ndl_u32(h + 8);
+  return true;
+}
+
+void noodle_model_close(NoodleModel &model) {
+  if (model.file) model.file.close();
+  model.count = 0;
+  model.align = 0;
+}
+
+bool noodle_model_find(NoodleModel &model, const char *name, NoodleTensorInfo *info) {
+  if (!name || !model.file) return false;
+  if (!noodle_seek_file(model.file, NOODLE_NDL_HEADER)) return false;
+
+  const size_t len = strlen(name);
+  if (len > NOODLE_NDL_NAME) return false;
+
+  uint8_t e[NOODLE_NDL_ENTRY];
+  for (uint16_t i = 0; i < model.count; i++) {
+    if (noodle_read_raw(model.file, e, sizeof(e)) != sizeof(e)) return false;
+    if (!noodle_ndl_match(e, name, len)) continue;
+    if (info) noodle_ndl_decode(e, info);
+    return true;
+  }
+  return false;
+}
+
+uint32_t noodle_model_offset(NoodleModel &model, const char *name) {
+  NoodleTensorInfo info;
+  if (!noodle_model_find(model, name, &info)) return 0;
+  if (info.dtype != NDL_DTYPE_F32) return 0;
+  return info.offset;
+}
+
+bool noodle_model_seek(NoodleModel &model, uint32_t offset, uint32_t index) {
+  return noodle_seek_file(model.file, offset + index * (uint32_t)sizeof(float));
+}
+
+uint32_t noodle_model_floats(NoodleModel &model, float *dst, uint32_t n) {
+  const uint32_t got = (uint32_t)(noodle_read_raw(model.file, dst, (size_t)n * sizeof(float)) / sizeof(float));
+  for (uint32_t i = got; i < n; i++) dst[i] = 0.0f;
+  return got;
+}
+
+float noodle_model_bias(NoodleModel &model, uint32_t offset, uint32_t index) {
+  if (offset == 0) return 0.0f;
+  float b = 0.0f;
+  noodle_model_seek(model, offset, index);
+  noodle_model_floats(model, &b, 1);
+  return b;
+}
+
+// ===== Mapped parameter source =====
+
+#if NOODLE_MAP_MMAP || NOODLE_MAP_PARTITION
+// Open mapped ranges, so noodle_map_hint() can tell mapped weights from RAM ones.
+#define NOODLE_MAP_SLOTS 8
+static const uint8_t *noodle_map_base[NOODLE_MAP_SLOTS];
+static size_t noodle_map_len[NOODLE_MAP_SLOTS];
+
+static void noodle_map_register(const NoodleMap &map) {
+  for (uint8_t i = 0; i < NOODLE_MAP_SLOTS; i++) {
+    if (!noodle_map_base[i]) {
+      noodle_map_base[i] = map.data;
+      noodle_map_len[i] = map.size;
+      return;
+    }
+  }
+  // Table full: the mapping still works, it just gets no fault-in hints.
+}
+
+static void noodle_map_unregister(const NoodleMap &map) {
+  for (uint8_t i = 0; i < NOODLE_MAP_SLOTS; i++)
+    if (noodle_map_base[i] == map.data) noodle_map_base[i] = nullptr;
+}
+#endif
+
+bool noodle_map_file(NoodleMap &map, const char *fn) {
+  map.data = nullptr;
+  map.size = 0;
+  map.handle = 0;
+#if NOODLE_MAP_MMAP
+  if (!fn) return false;
+  const int fd = open(noodle_norm_filename(fn), O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat st;
+  void *p = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+    p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // the mapping keeps its own reference
+  if (p == MAP_FAILED) return false;
+
+  map.data = (const uint8_t *)p;
+  map.size = (size_t)st.st_size;
+  noodle_map_register(map);
+  return true;
+#else
+  (void)fn;
+  return false;
+#endif
+}
+
+bool noodle_map_partition(NoodleMap &map, const char *label) {
+  map.data = nullptr;
+  map.size = 0;
+  map.handle = 0;
+#if NOODLE_MAP_PARTITION
+  if (!label) return false;
+  const esp_partition_t *part =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+  if (!part) return false;
+
+  const void *p = nullptr;
+  noodle_part_handle_t h;
+  if (esp_partition_mmap(part, 0, part->size, NOODLE_PART_MMAP_DATA, &p, &h) != ESP_OK)
+    return false;
+
+  map.data = (const uint8_t *)p;
+  map.size = part->size;
+  map.handle = (uint32_t)h;
+  noodle_map_register(map);
+  return true;
+#else
+  (void)label;
+  return false;
+#endif
+}
+
+void noodle_map_close(NoodleMap &map) {
+  if (!map.data) return;
+#if NOODLE_MAP_PARTITION
+  noodle_map_unregister(map);
+  noodle_part_munmap((noodle_part_handle_t)map.handle);
+#elif NOODLE_MAP_MMAP
+  noodle_map_unregister(map);
+  munmap((void *)map.data, map.size);
+#endif
+  map.data = nullptr;
+  map.size = 0;
+  map.handle = 0;
+}
+
+const float *noodle_map_tensor(const NoodleMap &map, const char *name, NoodleTensorInfo *info) {
+  if (!name || !map.data || map.size < NOODLE_NDL_HEADER) return nullptr;
+  const uint8_t *h = map.data;
+  if (memcmp(h, "NDL1", 4) != 0 || noodle_ndl_u16(h + 4) != 1) return nullptr;
+
+  const size_t len = strlen(name);
+  if (len > NOODLE_NDL_NAME) return nullptr;
+
+  const uint16_t count = noodle_ndl_u16(h + 6);
+  if ((size_t)NOODLE_NDL_HEADER + (size_t)count * NOODLE_NDL_ENTRY > map.size) return nullptr;
+
+  for (uint16_t i = 0; i < count; i++) {
+    const uint8_t *e = h + NOODLE_NDL_HEADER + (size_t)i * NOODLE_NDL_ENTRY;
+    if (!noodle_ndl_match(e, name, len)) continue;
+
+    NoodleTensorInfo t;
+    noodle_ndl_decode(e, &t);
+    if (info) *info = t;
+    if (t.dtype != NDL_DTYPE_F32 || (t.offset & 3u) != 0) return nullptr;
+    if ((size_t)t.offset + (size_t)t.count * sizeof(float) > map.size) return nullptr;
+    return (const float *)(map.data + t.offset);
+  }
+  return nullptr;
+}
+
+bool noodle_map_conv(const NoodleMap &map, const char *weight, const char *bias, ConvMem &conv) {
+  const float *w = noodle_map_tensor(map, weight);
+  const float *b = bias ? noodle_map_tensor(map, bias) : nullptr;
+  if (!w || (bias && !b)) return false;
+  conv.weight = w;
+  conv.bias = b;
+  return true;
+}
+
+bool noodle_map_fcn(const NoodleMap &map, const char *weight, const char *bias, FCNMem &fcn) {
+  const float *w = noodle_map_tensor(map, weight);
+  const float *b = bias ? noodle_map_tensor(map, bias) : nullptr;
+  if (!w || (bias && !b)) return false;
+  fcn.weight = w;
+  fcn.bias = b;
+  return true;
+}
+
+void noodle_map_hint(const float *p, size_t n) {
+#if NOODLE_MAP_MMAP
+  if (!p || n == 0) return;
+  const uint8_t *b = (const uint8_t *)p;
+  for (uint8_t i = 0; i < NOODLE_MAP_SLOTS; i++) {
+    const uint8_t *base = noodle_map_base[i];
+    if (!base || b < base || b >= base + noodle_map_len[i]) continue;
+
+    size_t bytes = n * sizeof(float);
+    const size_t left = (size_t)(base + noodle_map_len[i] - b);
+    if (bytes > left) bytes = left;
+    const uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    const uintptr_t lo = (uintptr_t)b & ~(page - 1);
+    madvise((void *)lo, (size_t)((uintptr_t)b + bytes - lo), MADV_WILLNEED);
+    return;
+  }
+#else
+  (void)p;
+  (void)n;
+#endif
+}
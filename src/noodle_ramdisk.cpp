@@ -0,0 +1,316 @@
+/**
+ * @file noodle_ramdisk.cpp
+ * @brief In-memory filesystem backend with a simulated storage clock.
+ * @ingroup noodle_api
+ *
+ * Compiled only when `NOODLE_USE_RAMDISK` is selected. See @ref noodle_ramdisk.
+ */
+#include "noodle_internal.h"
+
+#if defined(NOODLE_USE_RAMDISK)
+
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+  bool used;
+  char name[NOODLE_MAX_FILENAME + 2];
+  uint8_t *data;
+  size_t size;
+  size_t capacity;
+} NoodleRamDiskFile;
+
+typedef struct {
+  int16_t file;   // index into ramdisk_files, or -1 when the slot is free
+  uint32_t pos;
+} NoodleRamDiskSlot;
+
+static NoodleRamDiskFile ramdisk_files[NOODLE_RAMDISK_MAX_FILES];
+static NoodleRamDiskSlot ramdisk_slots[NOODLE_RAMDISK_MAX_OPEN] = {};
+static bool ramdisk_slots_ready = false;
+
+static NoodleRamDiskCost ramdisk_cost = {0, 0, 0, 0, 0};
+static NoodleRamDiskStats ramdisk_stats = {0, 0, 0, 0, 0, 0, 0};
+
+static void noodle_ramdisk_init_slots() {
+  if (ramdisk_slots_ready) return;
+  for (int i = 0; i < NOODLE_RAMDISK_MAX_OPEN; i++) ramdisk_slots[i].file = -1;
+  ramdisk_slots_ready = true;
+}
+
+static int16_t noodle_ramdisk_find(const char *path) {
+  if (!path) return -1;
+  for (int16_t i = 0; i < NOODLE_RAMDISK_MAX_FILES; i++) {
+    if (ramdisk_files[i].used && strcmp(ramdisk_files[i].name, path) == 0) return i;
+  }
+  return -1;
+}
+
+static int16_t noodle_ramdisk_create(const char *path) {
+  for (int16_t i = 0; i < NOODLE_RAMDISK_MAX_FILES; i++) {
+    if (!ramdisk_files[i].used) {
+      ramdisk_files[i].used = true;
+      noodle_copy_name(ramdisk_files[i].name, sizeof(ramdisk_files[i].name), path);
+      ramdisk_files[i].data = nullptr;
+      ramdisk_files[i].size = 0;
+      ramdisk_files[i].capacity = 0;
+      return i;
+    }
+  }
+  return -1;
+}
+
+static bool noodle_ramdisk_reserve(NoodleRamDiskFile &f, size_t n) {
+  if (n <= f.capacity) return true;
+
+  size_t cap = f.capacity ? f.capacity : 512;
+  while (cap < n) cap *= 2;
+
+  uint8_t *p = (uint8_t *)realloc(f.data, cap);
+  if (!p) return false;
+
+  f.data = p;
+  f.capacity = cap;
+  return true;
+}
+
+static NoodleRamDiskSlot *noodle_ramdisk_slot(int16_t slot) {
+  if (slot < 0 || slot >= NOODLE_RAMDISK_MAX_OPEN) return nullptr;
+  NoodleRamDiskSlot *s = &ramdisk_slots[slot];
+  return (s->file >= 0) ? s : nullptr;
+}
+
+static void noodle_ramdisk_charge(uint32_t fixed_ns, uint32_t per_byte_ns, size_t n) {
+  ramdisk_stats.elapsed_ns += (uint64_t)fixed_ns + (uint64_t)per_byte_ns * (uint64_t)n;
+}
+
+// ===== NDL_RamFile =====
+
+NDL_RamFile::operator bool() const {
+  return noodle_ramdisk_slot(_slot) != nullptr;
+}
+
+int NDL_RamFile::available() {
+  NoodleRamDiskSlot *s = noodle_ramdisk_slot(_slot);
+  if (!s) return 0;
+  const size_t size = ramdisk_files[s->file].size;
+  return (s->pos < size) ? (int)(size - s->pos) : 0;
+}
+
+int NDL_RamFile::read() {
+  uint8_t v = 0;
+  return (read(&v, 1) == 1) ? (int)v : -1;
+}
+
+size_t NDL_RamFile::read(uint8_t *dst, size_t n) {
+  NoodleRamDiskSlot *s = noodle_ramdisk_slot(_slot);
+  if (!s || !dst) return 0;
+
+  const NoodleRamDiskFile &f = ramdisk_files[s->file];
+  const size_t left = (s->pos < f.size) ? (f.size - s->pos) : 0;
+  const size_t got = (n < left) ? n : left;
+
+  if (got) memcpy(dst, f.data + s->pos, got);
+  s->pos += (uint32_t)got;
+
+  ramdisk_stats.read_calls++;
+  ramdisk_stats.bytes_read += got;
+  noodle_ramdisk_charge(ramdisk_cost.call_ns, ramdisk_cost.read_byte_ns, got);
+  return got;
+}
+
+int NDL_RamFile::peek() {
+  NoodleRamDiskSlot *s = noodle_ramdisk_slot(_slot);
+  if (!s) return -1;
+  const NoodleRamDiskFile &f = ramdisk_files[s->file];
+  return (s->pos < f.size) ? (int)f.data[s->pos] : -1;
+}
+
+size_t NDL_RamFile::write(const uint8_t *src, size_t n) {
+  NoodleRamDiskSlot *s = noodle_ramdisk_slot(_slot);
+  if (!s || !src) return 0;
+
+  NoodleRamDiskFile &f = ramdisk_files[s->file];
+  const size_t end = (size_t)s->pos + n;
+  if (!noodle_ramdisk_reserve(f, end)) return 0;
+
+  memcpy(f.data + s->pos, src, n);
+  s->pos = (uint32_t)end;
+  if (end > f.size) f.size = end;
+
+  ramdisk_stats.write_calls++;
+  ramdisk_stats.bytes_written += n;
+  noodle_ramdisk_charge(ramdisk_cost.call_ns, ramdisk_cost.write_byte_ns, n);
+  return n;
+}
+
+void NDL_RamFile::close() {
+  NoodleRamDiskSlot *s = noodle_ramdisk_slot(_slot);
+  if (s) s->file = -1;
+  _slot = -1;
+}
+
+size_t NDL_RamFile::size() {
+  NoodleRamDiskSlot *s = noodle_ramdisk_slot(_slot);
+  return s ? ramdisk_files[s->file].size : 0;
+}
+
+size_t NDL_RamFile::position() {
+  NoodleRamDiskSlot *s = noodle_ramdisk_slot(_slot);
+  return s ? s->pos : 0;
+}
+
+bool NDL_RamFile::seek(uint32_t pos) {
+  NoodleRamDiskSlot *s = noodle_ramdisk_slot(_slot);
+  if (!s || pos > ramdisk_files[s->file].size) return false;
+
+  s->pos = pos;
+  ramdisk_stats.seeks++;
+  noodle_ramdisk_charge(ramdisk_cost.seek_ns, 0, 0);
+  return true;
+}
+
+size_t NDL_RamFile::println(uint8_t v) {
+  char s[8];
+  const int n = snprintf(s, sizeof(s), "%u\r\n", (unsigned)v);
+  return (n > 0) ? write((const uint8_t *)s, (size_t)n) : 0;
+}
+
+size_t NDL_RamFile::println(float v, int digits) {
+  char s[48];
+  const int n = snprintf(s, sizeof(s), "%.*f\r\n", digits, (double)v);
+  if (n <= 0) return 0;
+  return write((const uint8_t *)s, ((size_t)n < sizeof(s)) ? (size_t)n : sizeof(s) - 1);
+}
+
+// ===== Backend API =====
+
+NDL_File noodle_ramdisk_open(const char *path, bool write) {
+  noodle_ramdisk_init_slots();
+
+  NDL_File h;
+  if (!path || !path[0]) return h;
+
+  int16_t slot = -1;
+  for (int16_t i = 0; i < NOODLE_RAMDISK_MAX_OPEN; i++) {
+    if (ramdisk_slots[i].file < 0) { slot = i; break; }
+  }
+  if (slot < 0) return h;
+
+  int16_t file = noodle_ramdisk_find(path);
+  if (file < 0) {
+    if (!write) return h;
+    file = noodle_ramdisk_create(path);
+    if (file < 0) return h;
+  } else if (write) {
+    ramdisk_files[file].size = 0;  // truncate, keep the allocation for reuse
+  }
+
+  ramdisk_slots[slot].file = file;
+  ramdisk_slots[slot].pos = 0;
+  h._slot = slot;
+
+  ramdisk_stats.opens++;
+  noodle_ramdisk_charge(ramdisk_cost.open_ns, 0, 0);
+  return h;
+}
+
+bool noodle_ramdisk_remove(const char *path) {
+  noodle_ramdisk_init_slots();
+
+  const int16_t file = noodle_ramdisk_find(path);
+  if (file < 0) return false;
+
+  // Invalidate handles that still refer to the removed file.
+  for (int i = 0; i < NOODLE_RAMDISK_MAX_OPEN; i++) {
+    if (ramdisk_slots[i].file == file) ramdisk_slots[i].file = -1;
+  }
+
+  free(ramdisk_files[file].data);
+  ramdisk_files[file].data = nullptr;
+  ramdisk_files[file].size = 0;
+  ramdisk_files[file].capacity = 0;
+  ramdisk_files[file].used = false;
+  return true;
+}
+
+bool noodle_ramdisk_put(const char *path, const void *data, size_t n) {
+  if (!path || !path[0] || (n && !data)) return false;
+
+  int16_t file = noodle_ramdisk_find(path);
+  if (file < 0) file = noodle_ramdisk_create(path);
+  if (file < 0) return false;
+
+  NoodleRamDiskFile &f = ramdisk_files[file];
+  if (!noodle_ramdisk_reserve(f, n)) return false;
+
+  if (n) memcpy(f.data, data, n);
+  f.size = n;
+  return true;
+}
+
+const uint8_t *noodle_ramdisk_data(const char *path, size_t *n) {
+  const int16_t file = noodle_ramdisk_find(path);
+  if (file < 0) {
+    if (n) *n = 0;
+    return nullptr;
+  }
+  if (n) *n = ramdisk_files[file].size;
+  return ramdisk_files[file].data;
+}
+
+void noodle_ramdisk_clear(void) {
+  for (int i = 0; i < NOODLE_RAMDISK_MAX_OPEN; i++) ramdisk_slots[i].file = -1;
+  ramdisk_slots_ready = true;
+
+  for (int i = 0; i < NOODLE_RAMDISK_MAX_FILES; i++) {
+    free(ramdisk_files[i].data);
+    ramdisk_files[i].data = nullptr;
+    ramdisk_files[i].size = 0;
+    ramdisk_files[i].capacity = 0;
+    ramdisk_files[i].used = false;
+  }
+}
+
+void noodle_ramdisk_set_cost(const NoodleRamDiskCost &cost) {
+  ramdisk_cost = cost;
+}
+
+NoodleRamDiskCost noodle_ramdisk_cost_sdspi(uint8_t sck_mhz) {
+  if (sck_mhz == 0) sck_mhz = 1;
+
+  NoodleRamDiskCost c;
+  c.open_ns       = 2000000;   // directory scan + FAT lookup over SPI
+  c.seek_ns       = 500000;    // cluster-chain walk + fresh sector read
+  c.call_ns       = 15000;     // SdFat call, CS toggle, command framing
+  c.read_byte_ns  = 8000u / sck_mhz;
+  c.write_byte_ns = 8000u / sck_mhz;
+  return c;
+}
+
+NoodleRamDiskCost noodle_ramdisk_cost_sdmmc(uint8_t bus_width, uint8_t clk_mhz) {
+  if (bus_width != 4) bus_width = 1;
+  if (clk_mhz == 0) clk_mhz = 1;
+
+  NoodleRamDiskCost c;
+  c.open_ns       = 500000;    // VFS + FATFS directory lookup
+  c.seek_ns       = 100000;
+  c.call_ns       = 5000;      // VFS dispatch and SDMMC transaction setup
+  c.read_byte_ns  = 8000u / ((uint32_t)bus_width * clk_mhz);
+  c.write_byte_ns = 8000u / ((uint32_t)bus_width * clk_mhz);
+  return c;
+}
+
+void noodle_ramdisk_reset_clock(void) {
+  memset(&ramdisk_stats, 0, sizeof(ramdisk_stats));
+}
+
+uint64_t noodle_ramdisk_elapsed_us(void) {
+  return ramdisk_stats.elapsed_ns / 1000u;
+}
+
+void noodle_ramdisk_get_stats(NoodleRamDiskStats *out) {
+  if (out) *out = ramdisk_stats;
+}
+
+#endif  // NOODLE_USE_RAMDISK
@@ -0,0 +1,522 @@
+/**
+ * @file noodle_simd.cpp
+ * @brief SSE2, AVX2 and NEON kernels behind runtime dispatch.
+ * @ingroup noodle_api
+ */
+#include "noodle_internal.h"
+
+#if NOODLE_SIMD
+  #if defined(__x86_64__) || defined(__i386__)
+    #define NOODLE_SIMD_X86 1
+    #include <immintrin.h>
+    #define NOODLE_AVX2 __attribute__((target("avx2,fma")))
+    // Without FMA, so element-wise multiply-adds are not contracted.
+    #define NOODLE_AVX2_EXACT __attribute__((target("avx2")))
+  #elif defined(__aarch64__)
+    #define NOODLE_SIMD_ARM 1
+    #include <arm_neon.h>
+  #endif
+#endif
+
+// ===== Dispatch =====
+
+#if NOODLE_SIMD
+static uint8_t noodle_simd_cur = 0xFF;  // 0xFF until the first query
+
+static NoodleSimd noodle_simd_best(void) {
+#if defined(NOODLE_SIMD_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SIMD_AVX2;
+  return SIMD_SSE2;
+#elif defined(NOODLE_SIMD_ARM)
+  return SIMD_NEON;
+#else
+  return SIMD_SCALAR;
+#endif
+}
+#endif
+
+NoodleSimd noodle_simd_active(void) {
+#if NOODLE_SIMD
+  if (noodle_simd_cur == 0xFF) noodle_simd_cur = noodle_simd_best();
+  return (NoodleSimd)noodle_simd_cur;
+#else
+  return SIMD_SCALAR;
+#endif
+}
+
+NoodleSimd noodle_simd_select(NoodleSimd level) {
+#if NOODLE_SIMD
+  const NoodleSimd best = noodle_simd_best();
+  bool ok = (level == SIMD_SCALAR) || (level == best);
+#if defined(NOODLE_SIMD_X86)
+  ok = ok || (level == SIMD_SSE2);
+#endif
+  noodle_simd_cur = ok ? level : best;
+#else
+  (void)level;
+#endif
+  return noodle_simd_active();
+}
+
+#if NOODLE_SIMD
+
+static inline float noodle_relu_scalar(float v, uint8_t relu) {
+  if (relu == NOODLE_RELU_NEG) return (v < 0.0f) ? 0.0f : v;
+  if (relu == NOODLE_RELU_POS) return (v > 0.0f) ? v : 0.0f;
+  return v;
+}
+
+// ===== x86: SSE2 baseline and AVX2/FMA =====
+
+#if defined(NOODLE_SIMD_X86)
+
+static float noodle_hsum_sse2(__m128 v) {
+  float t[4];
+  _mm_storeu_ps(t, v);
+  return (t[0] + t[1]) + (t[2] + t[3]);
+}
+
+static float noodle_dot_sse2(const float *x, const float *w, uint32_t n) {
+  __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(w + i)));
+    s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(x + i + 4), _mm_loadu_ps(w + i + 4)));
+  }
+  for (; i + 4 <= n; i += 4)
+    s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(w + i)));
+  float s = noodle_hsum_sse2(_mm_add_ps(s0, s1));
+  for (; i < n; i++) s += x[i] * w[i];
+  return s;
+}
+
+NOODLE_AVX2 static float noodle_dot_avx2(const float *x, const float *w, uint32_t n) {
+  __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    s0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(w + i), s0);
+    s1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(w + i + 8), s1);
+  }
+  for (; i + 8 <= n; i += 8)
+    s0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(w + i), s0);
+  s0 = _mm256_add_ps(s0, s1);
+  float s = noodle_hsum_sse2(_mm_add_ps(_mm256_castps256_ps128(s0), _mm256_extractf128_ps(s0, 1)));
+  for (; i < n; i++) s += x[i] * w[i];
+  return s;
+}
+
+// s * x + t per element as a separate multiply and add, like the scalar loop.
+static void noodle_affine_sse2(float *x, uint32_t n, float s, float t, uint8_t relu) {
+  const __m128 vs = _mm_set1_ps(s), vt = _mm_set1_ps(t), z = _mm_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 v = _mm_add_ps(_mm_mul_ps(vs, _mm_loadu_ps(x + i)), vt);
+    if (relu == NOODLE_RELU_NEG) v = _mm_andnot_ps(_mm_cmplt_ps(v, z), v);
+    else if (relu == NOODLE_RELU_POS) v = _mm_and_ps(v, _mm_cmpgt_ps(v, z));
+    _mm_storeu_ps(x + i, v);
+  }
+  for (; i < n; i++) x[i] = noodle_relu_scalar(s * x[i] + t, relu);
+}
+
+NOODLE_AVX2_EXACT static void noodle_affine_avx2(float *x, uint32_t n, float s, float t, uint8_t relu) {
+  const __m256 vs = _mm256_set1_ps(s), vt = _mm256_set1_ps(t), z = _mm256_setzero_ps();
+  uint32_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_add_ps(_mm256_mul_ps(vs, _mm256_loadu_ps(x + i)), vt);
+    if (relu == NOODLE_RELU_NEG) v = _mm256_andnot_ps(_mm256_cmp_ps(v, z, _CMP_LT_OQ), v);
+    else if (relu == NOODLE_RELU_POS) v = _mm256_and_ps(v, _mm256_cmp_ps(v, z, _CMP_GT_OQ));
+    _mm256_storeu_ps(x + i, v);
+  }
+  for (; i < n; i++) x[i] = noodle_relu_scalar(s * x[i] + t, relu);
+}
+
+// Even and odd lanes of eight consecutive floats.
+static inline void noodle_deint_sse2(const float *p, __m128 &even, __m128 &odd) {
+  const __m128 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4);
+  even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+  odd  = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static void noodle_pool2_sse2(const float *in, uint16_t W, float *out) {
+  const uint16_t Wo = (uint16_t)(W / 2);
+#if NOODLE_POOL_MODE != NOODLE_POOL_MAX
+  const __m128 q = _mm_set1_ps(0.25f);
+#endif
+  for (uint16_t y = 0; y < Wo; y++) {
+    const float *r0 = in + (uint32_t)(2 * y) * W;
+    const float *r1 = r0 + W;
+    float *o = out + (uint32_t)y * Wo;
+    uint16_t x = 0;
+    for (; (uint32_t)x + 4 <= Wo; x += 4) {
+      __m128 e0, o0, e1, o1;
+      noodle_deint_sse2(r0 + 2 * x, e0, o0);
+      noodle_deint_sse2(r1 + 2 * x, e1, o1);
+#if NOODLE_POOL_MODE == NOODLE_POOL_MAX
+      __m128 m = _mm_set1_ps(-FLT_MAX);  // max(v, m) is v > m ? v : m
+      m = _mm_max_ps(e0, m);
+      m = _mm_max_ps(o0, m);
+      m = _mm_max_ps(e1, m);
+      m = _mm_max_ps(o1, m);
+      _mm_storeu_ps(o + x, m);
+#else
+      __m128 a = _mm_add_ps(_mm_setzero_ps(), e0);
+      a = _mm_add_ps(a, o0);
+      a = _mm_add_ps(a, e1);
+      a = _mm_add_ps(a, o1);
+      _mm_storeu_ps(o + x, _mm_mul_ps(a, q));
+#endif
+    }
+    for (; x < Wo; x++) {
+      const float *p0 = r0 + 2 * x, *p1 = r1 + 2 * x;
+#if NOODLE_POOL_MODE == NOODLE_POOL_MAX
+      float m = -FLT_MAX;
+      if (p0[0] > m) m = p0[0];
+      if (p0[1] > m) m = p0[1];
+      if (p1[0] > m) m = p1[0];
+      if (p1[1] > m) m = p1[1];
+      o[x] = m;
+#else
+      float a = 0.0f;
+      a += p0[0];
+      a += p0[1];
+      a += p1[0];
+      a += p1[1];
+      o[x] = a * 0.25f;
+#endif
+    }
+  }
+}
+
+static inline __m128 noodle_row_load_sse2(const float *p, uint16_t S) {
+  if (S == 1) return _mm_loadu_ps(p);
+  __m128 e, o;
+  noodle_deint_sse2(p, e, o);
+  return e;
+}
+
+// Taps of the kernel summed from zero for groups of consecutive outputs, then
+// added to @p out, as in noodle_conv_strip(). x points at the first output's
+// window. Returns how many outputs were done; the caller finishes the rest.
+static uint16_t noodle_conv_row_sse2(const float *x, const float *kernel, uint16_t K,
+                                     uint16_t W, uint16_t S, float *out, uint16_t n) {
+  uint16_t t = 0;
+  // Stride 2 loads eight floats for four outputs; keep the last one in bounds.
+  for (; (uint32_t)t + 4 + (S == 2) <= n; t += 4) {
+    __m128 acc = _mm_setzero_ps();
+    const float *row = x + (uint32_t)t * S;
+    const float *kr = kernel;
+    for (uint16_t k = 0; k < K; k++, row += W, kr += K)
+      for (uint16_t l = 0; l < K; l++)
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(kr[l]), noodle_row_load_sse2(row + l, S)));
+    _mm_storeu_ps(out + t, _mm_add_ps(_mm_loadu_ps(out + t), acc));
+  }
+  return t;
+}
+
+NOODLE_AVX2 static inline __m256 noodle_row_load_avx2(const float *p, uint16_t S) {
+  if (S == 1) return _mm256_loadu_ps(p);
+  const __m256 a = _mm256_loadu_ps(p), b = _mm256_loadu_ps(p + 8);
+  const __m256 e = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+  return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(e), 0xD8));
+}
+
+NOODLE_AVX2 static uint16_t noodle_conv_row_avx2(const float *x, const float *kernel, uint16_t K,
+                                                 uint16_t W, uint16_t S, float *out, uint16_t n) {
+  uint16_t t = 0;
+  for (; (uint32_t)t + 16 + (S == 2) <= n; t += 16) {
+    __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+    const float *row = x + (uint32_t)t * S;
+    const float *kr = kernel;
+    for (uint16_t k = 0; k < K; k++, row += W, kr += K)
+      for (uint16_t l = 0; l < K; l++) {
+        const __m256 w = _mm256_set1_ps(kr[l]);
+        a0 = _mm256_fmadd_ps(w, noodle_row_load_avx2(row + l, S), a0);
+        a1 = _mm256_fmadd_ps(w, noodle_row_load_avx2(row + l + 8 * S, S), a1);
+      }
+    _mm256_storeu_ps(out + t, _mm256_add_ps(_mm256_loadu_ps(out + t), a0));
+    _mm256_storeu_ps(out + t + 8, _mm256_add_ps(_mm256_loadu_ps(out + t + 8), a1));
+  }
+  for (; (uint32_t)t + 8 + (S == 2) <= n; t += 8) {
+    __m256 acc = _mm256_setzero_ps();
+    const float *row = x + (uint32_t)t * S;
+    const float *kr = kernel;
+    for (uint16_t k = 0; k < K; k++, row += W, kr += K)
+      for (uint16_t l = 0; l < K; l++)
+        acc = _mm256_fmadd_ps(_mm256_set1_ps(kr[l]), noodle_row_load_avx2(row + l, S), acc);
+    _mm256_storeu_ps(out + t, _mm256_add_ps(_mm256_loadu_ps(out + t), acc));
+  }
+  return t;
+}
+
+#if NOODLE_CONV_OBLOCK == 8
+// Pixel-major block rows: each output pixel holds 8 channel accumulators.
+static uint16_t noodle_conv_block_row_sse2(const float *x, const float *wp, uint16_t K,
+                                           uint16_t W, uint16_t S, float *acc, uint16_t n) {
+  for (uint16_t j = 0; j < n; j++) {
+    __m128 a0 = _mm_setzero_ps(), a1 = _mm_setzero_ps();
+    const float *row = x + (uint32_t)j * S;
+    const float *w = wp;
+    for (uint16_t k = 0; k < K; k++, row += W)
+      for (uint16_t l = 0; l < K; l++, w += 8) {
+        const __m128 v = _mm_set1_ps(row[l]);
+        a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(w), v));
+        a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_loadu_ps(w + 4), v));
+      }
+    float *o = acc + (uint32_t)j * 8;
+    _mm_storeu_ps(o, _mm_add_ps(_mm_loadu_ps(o), a0));
+    _mm_storeu_ps(o + 4, _mm_add_ps(_mm_loadu_ps(o + 4), a1));
+  }
+  return n;
+}
+
+NOODLE_AVX2 static uint16_t noodle_conv_block_row_avx2(const float *x, const float *wp, uint16_t K,
+                                                       uint16_t W, uint16_t S, float *acc, uint16_t n) {
+  uint16_t j = 0;
+  for (; j + 4 <= n; j += 4) {  // four pixels share each weight load
+    __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+    __m256 a2 = _mm256_setzero_ps(), a3 = _mm256_setzero_ps();
+    const float *row = x + (uint32_t)j * S;
+    const float *w = wp;
+    for (uint16_t k = 0; k < K; k++, row += W)
+      for (uint16_t l = 0; l < K; l++, w += 8) {
+        const __m256 wv = _mm256_loadu_ps(w);
+        a0 = _mm256_fmadd_ps(wv, _mm256_set1_ps(row[l]), a0);
+        a1 = _mm256_fmadd_ps(wv, _mm256_set1_ps(row[l + S]), a1);
+        a2 = _mm256_fmadd_ps(wv, _mm256_set1_ps(row[l + 2 * S]), a2);
+        a3 = _mm256_fmadd_ps(wv, _mm256_set1_ps(row[l + 3 * S]), a3);
+      }
+    float *o = acc + (uint32_t)j * 8;
+    _mm256_storeu_ps(o,      _mm256_add_ps(_mm256_loadu_ps(o),      a0));
+    _mm256_storeu_ps(o + 8,  _mm256_add_ps(_mm256_loadu_ps(o + 8),  a1));
+    _mm256_storeu_ps(o + 16, _mm256_add_ps(_mm256_loadu_ps(o + 16), a2));
+    _mm256_storeu_ps(o + 24, _mm256_add_ps(_mm256_loadu_ps(o + 24), a3));
+  }
+  for (; j < n; j++) {
+    __m256 a = _mm256_setzero_ps();
+    const float *row = x + (uint32_t)j * S;
+    const float *w = wp;
+    for (uint16_t k = 0; k < K; k++, row += W)
+      for (uint16_t l = 0; l < K; l++, w += 8)
+        a = _mm256_fmadd_ps(_mm256_loadu_ps(w), _mm256_set1_ps(row[l]), a);
+    float *o = acc + (uint32_t)j * 8;
+    _mm256_storeu_ps(o, _mm256_add_ps(_mm256_loadu_ps(o), a));
+  }
+  return n;
+}
+#endif
+
+#endif  // NOODLE_SIMD_X86
+
+// ===== AArch64 NEON =====
+
+#if defined(NOODLE_SIMD_ARM)
+
+static float noodle_dot_neon(const float *x, const float *w, uint32_t n) {
+  float32x4_t s0 = vdupq_n_f32(0.0f), s1 = vdupq_n_f32(0.0f);
+  uint32_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    s0 = vfmaq_f32(s0, vld1q_f32(x + i), vld1q_f32(w + i));
+    s1 = vfmaq_f32(s1, vld1q_f32(x + i + 4), vld1q_f32(w + i + 4));
+  }
+  for (; i + 4 <= n; i += 4)
+    s0 = vfmaq_f32(s0, vld1q_f32(x + i), vld1q_f32(w + i));
+  float s = vaddvq_f32(vaddq_f32(s0, s1));
+  for (; i < n; i++) s += x[i] * w[i];
+  return s;
+}
+
+static void noodle_affine_neon(float *x, uint32_t n, float s, float t, uint8_t relu) {
+  const float32x4_t vs = vdupq_n_f32(s), vt = vdupq_n_f32(t), z = vdupq_n_f32(0.0f);
+  uint32_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t v = vaddq_f32(vmulq_f32(vs, vld1q_f32(x + i)), vt);
+    if (relu == NOODLE_RELU_NEG) v = vbslq_f32(vcltq_f32(v, z), z, v);
+    else if (relu == NOODLE_RELU_POS) v = vbslq_f32(vcgtq_f32(v, z), v, z);
+    vst1q_f32(x + i, v);
+  }
+  for (; i < n; i++) x[i] = noodle_relu_scalar(s * x[i] + t, relu);
+}
+
+static void noodle_pool2_neon(const float *in, uint16_t W, float *out) {
+  const uint16_t Wo = (uint16_t)(W / 2);
+  for (uint16_t y = 0; y < Wo; y++) {
+    const float *r0 = in + (uint32_t)(2 * y) * W;
+    const float *r1 = r0 + W;
+    float *o = out + (uint32_t)y * Wo;
+    uint16_t x = 0;
+    for (; (uint32_t)x + 4 <= Wo; x += 4) {
+      const float32x4x2_t a = vld2q_f32(r0 + 2 * x);
+      const float32x4x2_t b = vld2q_f32(r1 + 2 * x);
+#if NOODLE_POOL_MODE == NOODLE_POOL_MAX
+      float32x4_t m = vdupq_n_f32(-FLT_MAX);
+      m = vbslq_f32(vcgtq_f32(a.val[0], m), a.val[0], m);
+      m = vbslq_f32(vcgtq_f32(a.val[1], m), a.val[1], m);
+      m = vbslq_f32(vcgtq_f32(b.val[0], m), b.val[0], m);
+      m = vbslq_f32(vcgtq_f32(b.val[1], m), b.val[1], m);
+      vst1q_f32(o + x, m);
+#else
+      float32x4_t s = vaddq_f32(vdupq_n_f32(0.0f), a.val[0]);
+      s = vaddq_f32(s, a.val[1]);
+      s = vaddq_f32(s, b.val[0]);
+      s = vaddq_f32(s, b.val[1]);
+      vst1q_f32(o + x, vmulq_n_f32(s, 0.25f));
+#endif
+    }
+    for (; x < Wo; x++) {
+      const float *p0 = r0 + 2 * x, *p1 = r1 + 2 * x;
+#if NOODLE_POOL_MODE == NOODLE_POOL_MAX
+      float m = -FLT_MAX;
+      if (p0[0] > m) m = p0[0];
+      if (p0[1] > m) m = p0[1];
+      if (p1[0] > m) m = p1[0];
+      if (p1[1] > m) m = p1[1];
+      o[x] = m;
+#else
+      float a = 0.0f;
+      a += p0[0];
+      a += p0[1];
+      a += p1[0];
+      a += p1[1];
+      o[x] = a * 0.25f;
+#endif
+    }
+  }
+}
+
+static inline float32x4_t noodle_row_load_neon(const float *p, uint16_t S) {
+  if (S == 1) return vld1q_f32(p);
+  return vld2q_f32(p).val[0];
+}
+
+static uint16_t noodle_conv_row_neon(const float *x, const float *kernel, uint16_t K,
+                                     uint16_t W, uint16_t S, float *out, uint16_t n) {
+  uint16_t t = 0;
+  for (; (uint32_t)t + 8 + (S == 2) <= n; t += 8) {
+    float32x4_t a0 = vdupq_n_f32(0.0f), a1 = vdupq_n_f32(0.0f);
+    const float *row = x + (uint32_t)t * S;
+    const float *kr = kernel;
+    for (uint16_t k = 0; k < K; k++, row += W, kr += K)
+      for (uint16_t l = 0; l < K; l++) {
+        a0 = vfmaq_n_f32(a0, noodle_row_load_neon(row + l, S), kr[l]);
+        a1 = vfmaq_n_f32(a1, noodle_row_load_neon(row + l + 4 * S, S), kr[l]);
+      }
+    vst1q_f32(out + t, vaddq_f32(vld1q_f32(out + t), a0));
+    vst1q_f32(out + t + 4, vaddq_f32(vld1q_f32(out + t + 4), a1));
+  }
+  return t;
+}
+
+#if NOODLE_CONV_OBLOCK == 8
+static uint16_t noodle_conv_block_row_neon(const float *x, const float *wp, uint16_t K,
+                                           uint16_t W, uint16_t S, float *acc, uint16_t n) {
+  uint16_t j = 0;
+  for (; j + 2 <= n; j += 2) {  // two pixels share each weight load
+    float32x4_t a0 = vdupq_n_f32(0.0f), a1 = vdupq_n_f32(0.0f);
+    float32x4_t b0 = vdupq_n_f32(0.0f), b1 = vdupq_n_f32(0.0f);
+    const float *row = x + (uint32_t)j * S;
+    const float *w = wp;
+    for (uint16_t k = 0; k < K; k++, row += W)
+      for (uint16_t l = 0; l < K; l++, w += 8) {
+        const float32x4_t w0 = vld1q_f32(w), w1 = vld1q_f32(w + 4);
+        a0 = vfmaq_n_f32(a0, w0, row[l]);
+        a1 = vfmaq_n_f32(a1, w1, row[l]);
+        b0 = vfmaq_n_f32(b0, w0, row[l + S]);
+        b1 = vfmaq_n_f32(b1, w1, row[l + S]);
+      }
+    float *o = acc + (uint32_t)j * 8;
+    vst1q_f32(o,      vaddq_f32(vld1q_f32(o),      a0));
+    vst1q_f32(o + 4,  vaddq_f32(vld1q_f32(o + 4),  a1));
+    vst1q_f32(o + 8,  vaddq_f32(vld1q_f32(o + 8),  b0));
+    vst1q_f32(o + 12, vaddq_f32(vld1q_f32(o + 12), b1));
+  }
+  for (; j < n; j++) {
+    float32x4_t a0 = vdupq_n_f32(0.0f), a1 = vdupq_n_f32(0.0f);
+    const float *row = x + (uint32_t)j * S;
+    const float *w = wp;
+    for (uint16_t k = 0; k < K; k++, row += W)
+      for (uint16_t l = 0; l < K; l++, w += 8) {
+        a0 = vfmaq_n_f32(a0, vld1q_f32(w), row[l]);
+        a1 = vfmaq_n_f32(a1, vld1q_f32(w + 4), row[l]);
+      }
+    float *o = acc + (uint32_t)j * 8;
+    vst1q_f32(o,     vaddq_f32(vld1q_f32(o),     a0));
+    vst1q_f32(o + 4, vaddq_f32(vld1q_f32(o + 4), a1));
+  }
+  return n;
+}
+#endif
+
+#endif  // NOODLE_SIMD_ARM
+
+// ===== Kernel entry points =====
+
+bool noodle_simd_dot(const float *x, const float *w, uint32_t n, float &sum) {
+  switch (noodle_simd_active()) {
+#if defined(NOODLE_SIMD_X86)
+    case SIMD_SSE2: sum = noodle_dot_sse2(x, w, n); return true;
+    case SIMD_AVX2: sum = noodle_dot_avx2(x, w, n); return true;
+#elif defined(NOODLE_SIMD_ARM)
+    case SIMD_NEON: sum = noodle_dot_neon(x, w, n); return true;
+#endif
+    default: return false;
+  }
+}
+
+bool noodle_simd_affine(float *x, uint32_t n, float s, float t, uint8_t relu) {
+  switch (noodle_simd_active()) {
+#if defined(NOODLE_SIMD_X86)
+    case SIMD_SSE2: noodle_affine_sse2(x, n, s, t, relu); return true;
+    case SIMD_AVX2: noodle_affine_avx2(x, n, s, t, relu); return true;
+#elif defined(NOODLE_SIMD_ARM)
+    case SIMD_NEON: noodle_affine_neon(x, n, s, t, relu); return true;
+#endif
+    default: return false;
+  }
+}
+
+bool noodle_simd_pool2(const float *in, uint16_t W, float *out) {
+  switch (noodle_simd_active()) {
+#if defined(NOODLE_SIMD_X86)
+    case SIMD_SSE2:
+    case SIMD_AVX2: noodle_pool2_sse2(in, W, out); return true;
+#elif defined(NOODLE_SIMD_ARM)
+    case SIMD_NEON: noodle_pool2_neon(in, W, out); return true;
+#endif
+    default: return false;
+  }
+}
+
+uint16_t noodle_simd_conv_row(const float *x, const float *kernel, uint16_t K,
+                              uint16_t W, uint16_t S, float *out, uint16_t n) {
+  if (S > 2) return 0;
+  switch (noodle_simd_active()) {
+#if defined(NOODLE_SIMD_X86)
+    case SIMD_SSE2: return noodle_conv_row_sse2(x, kernel, K, W, S, out, n);
+    case SIMD_AVX2: return noodle_conv_row_avx2(x, kernel, K, W, S, out, n);
+#elif defined(NOODLE_SIMD_ARM)
+    case SIMD_NEON: return noodle_conv_row_neon(x, kernel, K, W, S, out, n);
+#endif
+    default: return 0;
+  }
+}
+
+uint16_t noodle_simd_conv_block_row(const float *x, const float *wp, uint16_t K,
+                                    uint16_t W, uint16_t S, float *acc, uint16_t n) {
+#if NOODLE_CONV_OBLOCK == 8
+  switch (noodle_simd_active()) {
+#if defined(NOODLE_SIMD_X86)
+    case SIMD_SSE2: return noodle_conv_block_row_sse2(x, wp, K, W, S, acc, n);
+    case SIMD_AVX2: return noodle_conv_block_row_avx2(x, wp, K, W, S, acc, n);
+#elif defined(NOODLE_SIMD_ARM)
+    case SIMD_NEON: return noodle_conv_block_row_neon(x, wp, K, W, S, acc, n);
+#endif
+    default: return 0;
+  }
+#else
+  (void)x; (void)wp; (void)K; (void)W; (void)S; (void)acc; (void)n;
+  return 0;
+#endif
+}
+
+#endif  // NOODLE_SIMD
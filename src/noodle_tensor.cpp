@@ -237,6 +237,23 @@ uint16_t noodle_dwconv2d(NoodleTensor *input,
   return Wout;
 }
 
+uint16_t noodle_dwpw2d(NoodleTensor *input,
+                       NoodleTensor *output,
+                       const ConvMem &dw,
+                       const ConvMem &pw,
+                       const Pool &pool) {
+  if (!noodle_tensor_valid_2d(input) || !output || pw.O == 0) return 0;
+
+  const uint16_t Wout = noodle_dwpw_float(&input->buffer, input->C, pw.O, &output->buffer,
+                                          input->W, dw, pw, pool, NULL);
+  if (Wout == 0) return 0;
+
+  output->C = pw.O;
+  output->W = Wout;
+  output->rank = NOODLE_TENSOR_2D;
+  return Wout;
+}
+
 uint16_t noodle_pool2d(NoodleTensor *input,
                        NoodleTensor *output,
                        uint16_t K,